@@ -3,4 +3,6 @@
 #include <AppCore/Window.h>
 #include <AppCore/Overlay.h>
 #include <AppCore/JSHelpers.h>
-#include <AppCore/Platform.h>
\ No newline at end of file
+#include <AppCore/Platform.h>
+#include <AppCore/Archive.h>
+#include <AppCore/CachingFileSystem.h>
\ No newline at end of file
@@ -0,0 +1,149 @@
+///
+/// @file Archive.h
+///
+/// @brief The header for the packed archive format used by GetArchiveFileSystem.
+///
+/// @author
+///
+/// This file is a part of Ultralight, a next-generation HTML renderer.
+///
+/// Website: <http://ultralig.ht>
+///
+/// Copyright (C) 2021 Ultralight, Inc. All rights reserved.
+///
+#pragma once
+#include "Defines.h"
+
+namespace ultralight {
+
+///
+/// Archive files are memory-mapped as a whole and laid out as follows (all values are
+/// little-endian):
+///
+/// <pre>
+///   ArchiveHeader
+///   ArchiveEntry[entry_count]   (sorted by path_hash, then by path)
+///   String table                (UTF-8 paths, mime-types, and charsets, not null-terminated)
+///   File data                   (each entry starts on a 16-byte boundary)
+/// </pre>
+///
+/// Lookups normalize the requested path with ArchiveNormalizePath, hash it with ArchivePathHash,
+/// and binary search the directory, no per-file syscalls are needed after the archive is mapped.
+///
+/// Packers must store paths normalized with ArchiveNormalizePath (and hash the normalized path)
+/// so that they match at runtime.
+///
+/// @note  A packer tool is not included in this repository, everything needed to write one is
+///        defined in this header.
+///
+static constexpr uint32_t kArchiveMagic = 0x4B504C55; // "ULPK"
+static constexpr uint32_t kArchiveVersion = 1;
+static constexpr uint32_t kArchiveDataAlignment = 16;
+
+///
+/// Compression used for an archive entry's data.
+///
+enum class AExport ArchiveCompression : uint8_t {
+  ///
+  /// Stored as-is, OpenFile returns a Buffer that wraps the mapped data without any copies.
+  ///
+  None,
+
+  ///
+  /// LZ4 block format, decompressed on demand into an aligned Buffer.
+  ///
+  LZ4,
+
+  ///
+  /// Zstandard frame format, decompressed on demand into an aligned Buffer.
+  ///
+  Zstd,
+};
+
+#pragma pack(push, 1)
+
+///
+/// Archive header, stored at offset 0.
+///
+struct AExport ArchiveHeader {
+  uint32_t magic;               // Must be kArchiveMagic
+  uint32_t version;             // Must be kArchiveVersion
+  uint32_t entry_count;         // Number of entries in the directory
+  uint32_t reserved;            // Must be 0
+  uint64_t string_table_offset; // Offset of the string table from the start of the archive
+  uint64_t string_table_size;   // Size of the string table in bytes
+};
+
+///
+/// Archive directory entry, entries immediately follow the ArchiveHeader.
+///
+/// String offsets are relative to the start of the string table.
+///
+struct AExport ArchiveEntry {
+  uint64_t path_hash;        // ArchivePathHash of the path
+  uint32_t path_offset;      // Normalized relative path (eg, "images/logo.png")
+  uint32_t path_length;
+  uint32_t mime_type_offset; // Precomputed mime-type (eg, "text/html")
+  uint32_t mime_type_length;
+  uint32_t charset_offset;   // Precomputed charset (eg, "utf-8")
+  uint32_t charset_length;
+  uint64_t data_offset;      // Offset of the data from the start of the archive (16-byte aligned)
+  uint64_t stored_size;      // Size of the data as stored in the archive
+  uint64_t original_size;    // Size of the data after decompression
+  ArchiveCompression compression;
+  uint8_t reserved[7];       // Must be 0
+};
+
+#pragma pack(pop)
+
+///
+/// Normalize a relative archive path, the result is written to 'out' (which must have room for at
+/// least 'len' characters, it may point to 'path' to normalize in place) and its length is
+/// returned.
+///
+/// The following rules are applied:
+///   - Backslashes are converted to forward slashes ('\\' -> '/').
+///   - Leading slashes and "./" segments are removed (eg, "/./images/logo.png" ->
+///     "images/logo.png"), as are repeated slashes and any "./" segments within the path.
+///   - Case is preserved, lookups are case-sensitive.
+///   - ".." segments are not resolved, packers should reject paths containing
+///     them since they will never match at runtime.
+///
+inline size_t ArchiveNormalizePath(const char* path, size_t len, char* out) {
+  size_t out_len = 0;
+  size_t i = 0;
+  while (i < len) {
+    // Find the end of the current segment
+    size_t start = i;
+    while (i < len && path[i] != '/' && path[i] != '\\')
+      i++;
+    size_t seg_len = i - start;
+    // Skip the separator
+    if (i < len)
+      i++;
+    // Drop empty and "." segments
+    if (seg_len == 0 || (seg_len == 1 && path[start] == '.'))
+      continue;
+    if (out_len)
+      out[out_len++] = '/';
+    for (size_t j = 0; j < seg_len; j++)
+      out[out_len++] = path[start + j];
+  }
+  return out_len;
+}
+
+///
+/// Hash a normalized archive path (64-bit FNV-1a), used to sort and search the directory.
+///
+/// @note  The path should first be normalized with ArchiveNormalizePath.
+///
+inline uint64_t ArchivePathHash(const char* path, size_t len) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (uint8_t)path[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace ultralight
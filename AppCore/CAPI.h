@@ -456,8 +456,23 @@ ACExport void ulOverlayUnfocus(ULOverlay overlay);
 ///
 /// Initializes the platform font loader and sets it as the current FontLoader.
 ///
+/// @note  On Linux, the installed fonts are described by a binary index stored in the cache path.
+///        The index is opened lazily on the loader's first font lookup (after the renderer has
+///        been created, so the cache path from the config passed to ulCreateRenderer() is used).
+///        If no cache path is set, the index is rebuilt on every launch.
+///
 ACExport void ulEnablePlatformFontLoader();
 
+///
+/// Delete the on-disk platform font index (Linux only) so that it is rebuilt the next time it is
+/// opened (on the platform font loader's first font lookup, eg, on the next launch). An index that
+/// is already open in this process remains in use.
+///
+/// You only need to call this if fonts were changed in a way that doesn't update the modification
+/// time of a font directory.
+///
+ACExport void ulInvalidatePlatformFontIndex();
+
 ///
 /// This is only needed if you are not calling ulCreateApp().
 ///
@@ -468,6 +483,54 @@ ACExport void ulEnablePlatformFontLoader();
 ///
 ACExport void ulEnablePlatformFileSystem(ULString base_dir);
 
+///
+/// This is only needed if you are not calling ulCreateApp().
+///
+/// Initializes a file system backed by a single memory-mapped archive (see
+/// <AppCore/Archive.h>) and sets it as the current FileSystem.
+///
+/// Returns false if the archive could not be mapped or is invalid.
+///
+ACExport bool ulEnableArchiveFileSystem(ULString archive_path);
+
+///
+/// Wraps the current FileSystem with a cache that memoizes file metadata (exists, mime-type,
+/// charset) and keeps the most recently opened buffers in memory.
+///
+/// You should call this after setting your FileSystem (eg, after ulPlatformSetFileSystem or
+/// ulEnablePlatformFileSystem) and before ulCreateRenderer().
+///
+/// @param  max_content_bytes   The max total size (in bytes) of file buffers to keep in the cache.
+///                             Pass 0 to only cache metadata.
+///
+/// @param  validate_mod_times  Whether or not to invalidate cached entries when the file's
+///                             modification time changes.
+///
+ACExport void ulEnableFileSystemCache(unsigned int max_content_bytes, bool validate_mod_times);
+
+///
+/// Remove all cached metadata and content for a certain file path from the cache enabled via
+/// ulEnableFileSystemCache(). Pass NULL to clear the entire cache.
+///
+ACExport void ulInvalidateFileSystemCache(ULString file_path);
+
+///
+/// File system cache statistics, @see ulGetFileSystemCacheStats
+///
+typedef struct {
+  unsigned long long metadata_hits;
+  unsigned long long metadata_misses;
+  unsigned long long content_hits;
+  unsigned long long content_misses;
+  unsigned int content_entries;
+  unsigned long long content_bytes;
+} ULFileSystemCacheStats;
+
+///
+/// Get the hit rates and current size of the cache enabled via ulEnableFileSystemCache().
+///
+ACExport ULFileSystemCacheStats ulGetFileSystemCacheStats();
+
 ///
 /// This is only needed if you are not calling ulCreateApp().
 ///
@@ -0,0 +1,123 @@
+///
+/// @file CachingFileSystem.h
+///
+/// @brief The header for the CachingFileSystem class.
+///
+/// @author
+///
+/// This file is a part of Ultralight, a next-generation HTML renderer.
+///
+/// Website: <http://ultralig.ht>
+///
+/// Copyright (C) 2021 Ultralight, Inc. All rights reserved.
+///
+#pragma once
+#include "Defines.h"
+#include <Ultralight/String.h>
+#include <Ultralight/platform/FileSystem.h>
+
+namespace ultralight {
+
+///
+/// Cache statistics, @see CachingFileSystem::stats
+///
+struct AExport FileSystemCacheStats {
+  ///
+  /// The number of FileExists, GetFileMimeType, and GetFileCharset calls answered from the cache.
+  ///
+  uint64_t metadata_hits = 0;
+
+  ///
+  /// The number of FileExists, GetFileMimeType, and GetFileCharset calls forwarded to the
+  /// underlying FileSystem.
+  ///
+  uint64_t metadata_misses = 0;
+
+  ///
+  /// The number of OpenFile and OpenFileAsync calls answered with a cached Buffer.
+  ///
+  uint64_t content_hits = 0;
+
+  ///
+  /// The number of OpenFile and OpenFileAsync calls forwarded to the underlying FileSystem.
+  ///
+  uint64_t content_misses = 0;
+
+  ///
+  /// The number of Buffers currently held in the cache.
+  ///
+  uint32_t content_entries = 0;
+
+  ///
+  /// The total size (in bytes) of the Buffers currently held in the cache.
+  ///
+  uint64_t content_bytes = 0;
+};
+
+///
+/// @brief  A FileSystem that wraps another FileSystem and caches its results.
+///
+/// The library queries FileExists, GetFileMimeType, GetFileCharset, and OpenFile separately for
+/// each request. This wrapper memoizes the metadata calls and keeps the most recently opened
+/// Buffers in an LRU cache (bounded by a byte budget) so repeated loads of the same file don't
+/// re-hash paths, re-sniff charsets, or re-read file data.
+///
+/// Usage:
+/// <pre>
+///   CachingFileSystem* fs = CachingFileSystem::Create(GetPlatformFileSystem("./assets/"),
+///                                                     16 * 1024 * 1024, true);
+///   Platform::instance().set_file_system(fs);
+/// </pre>
+///
+/// Asynchronous loads are preserved: OpenFileAsync answers cache hits by completing the request
+/// immediately, and forwards misses to the wrapped FileSystem's OpenFileAsync with an
+/// intermediate FileRequest-- when that request is completed, the Buffer (along with its
+/// mime-type and charset) is added to the cache and then passed on to the original request. If
+/// the wrapped FileSystem returns false, so does this wrapper (so the library falls back to
+/// OpenFile, which is cached as usual).
+///
+/// @note  All member functions are thread-safe. GetFileSize, GetFileModificationTime, and
+///        ReadFileRange are forwarded to the wrapped FileSystem (ranged reads are not cached).
+///
+class AExport CachingFileSystem : public FileSystem {
+ public:
+  ///
+  /// Create a caching wrapper around an existing FileSystem.
+  ///
+  /// @param  file_system         The FileSystem to wrap, ownership remains with the caller (it
+  ///                             must outlive the returned instance).
+  ///
+  /// @param  max_content_bytes   The max total size (in bytes) of file Buffers to keep in the
+  ///                             cache. Pass 0 to only cache metadata.
+  ///
+  /// @param  validate_mod_times  Whether or not to check FileSystem::GetFileModificationTime
+  ///                             before returning a cached result, entries are invalidated when
+  ///                             the modification time changes.
+  ///
+  /// @return  A new instance, you are responsible for deleting it once the Renderer is destroyed.
+  ///
+  static CachingFileSystem* Create(FileSystem* file_system, uint32_t max_content_bytes,
+                                   bool validate_mod_times);
+
+  ///
+  /// Get the wrapped FileSystem.
+  ///
+  virtual FileSystem* file_system() const = 0;
+
+  ///
+  /// Remove all cached metadata and content for a certain file path.
+  ///
+  virtual void Invalidate(const String& file_path) = 0;
+
+  ///
+  /// Remove all cached metadata and content.
+  ///
+  virtual void InvalidateAll() = 0;
+
+  ///
+  /// Get the cache hit rates and current size.
+  ///
+  virtual FileSystemCacheStats stats() const = 0;
+};
+
+}  // namespace ultralight
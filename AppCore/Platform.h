@@ -25,8 +25,26 @@ namespace ultralight {
 ///
 /// @note  This singleton is owned by the library, do not destroy it.
 ///
+/// @note  On Linux, the installed fonts are described by a versioned binary index (family,
+///        weight, style, character coverage, and path of every face) stored in Config::cache_path.
+///        The index is opened lazily on the loader's first font lookup (after the Renderer has
+///        been created, so its Config is available regardless of the order in which you set up
+///        the platform) and memory-mapped so Load and the fallback lookups don't need to scan the
+///        system fonts or query fontconfig. It is rebuilt automatically when any font directory's
+///        modification time changes, or on every launch if no cache path is set.
+///
 AExport FontLoader* GetPlatformFontLoader();
 
+///
+/// Delete the on-disk platform font index so that it is rebuilt the next time it is opened (on the
+/// platform font loader's first font lookup, eg, on the next launch). An index that is already
+/// open in this process remains in use.
+///
+/// You only need to call this if fonts were changed in a way that doesn't update the
+/// modification time of a font directory. This does nothing on platforms without an index.
+///
+AExport void InvalidatePlatformFontIndex();
+
 ///
 /// Get the native file system for the current platform, creating it if it
 /// doesn't exist using the base directory provided.
@@ -41,6 +59,24 @@ AExport FontLoader* GetPlatformFontLoader();
 ///
 AExport FileSystem* GetPlatformFileSystem(const String& baseDir);
 
+///
+/// Get a file system backed by a single packed archive, creating it if it doesn't exist by
+/// memory-mapping the archive at the path provided. @see <AppCore/Archive.h>
+///
+/// This avoids per-file open/stat/read syscalls: paths are looked up in the archive's sorted
+/// directory, mime-types and charsets are precomputed, uncompressed entries are wrapped in a
+/// Buffer without any copies, and LZ4/zstd entries are decompressed on demand.
+///
+/// Requested paths are normalized with ArchiveNormalizePath before lookup (eg, "/images/a.png"
+/// and ".\\images\\a.png" both resolve to "images/a.png"), lookups are case-sensitive.
+///
+/// @param  archivePath  The file path of the archive to map.
+///
+/// @note  This singleton is owned by the library, do not destroy it. Returns nullptr if the
+///        archive could not be mapped or is invalid.
+///
+AExport FileSystem* GetArchiveFileSystem(const String& archivePath);
+
 ///
 /// Get the default logger (writes the log to a file on disk).
 ///
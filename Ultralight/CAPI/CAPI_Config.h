@@ -54,6 +54,25 @@ ULExport void ulConfigSetFontHinting(ULConfig config, ULFontHinting font_hinting
 ///
 ULExport void ulConfigSetFontGamma(ULConfig config, double font_gamma);
 
+///
+/// Set whether or not to cache the fallback fonts returned by the font loader, keyed by Unicode
+/// block, weight, and italic. A cached family is only reused when its character map covers the
+/// characters being rendered, otherwise the font loader is queried again. (Default = False)
+///
+ULExport void ulConfigSetCacheFontFallbacks(ULConfig config, bool enabled);
+
+///
+/// Set whether or not to persist rasterized glyphs to a "glyphs" subdirectory of the cache path so
+/// they can be reused on the next launch. Entries are keyed by the font's content hash (not its
+/// path), font size, font hinting, font gamma, and the library version, so updated fonts and SDK
+/// upgrades invalidate old glyphs. For on-disk fonts, the content hash is derived from the file
+/// size and OpenType table checksums, so the font is never read in full to look up its glyphs.
+/// The cache is written when you call ulSaveGlyphCache(). (Default = False)
+///
+/// @note  This has no effect if the cache path is empty.
+///
+ULExport void ulConfigSetEnableGlyphCachePersistence(ULConfig config, bool enabled);
+
 ///
 /// Set user stylesheet (CSS) (Default = Empty).
 ///
@@ -65,6 +84,15 @@ ULExport void ulConfigSetUserStylesheet(ULConfig config, ULString css_string);
 ///
 ULExport void ulConfigSetForceRepaint(ULConfig config, bool enabled);
 
+///
+/// Set whether or not we should analyze the GPU command list generated for each View every frame
+/// (overdraw, redundant binds, tiny draws, etc.). This is mainly used to diagnose GPU performance
+/// issues and does not require a real GPU. (Default = False)
+///
+/// @see ulViewGetFrameAnalysis
+///
+ULExport void ulConfigSetEnableFrameAnalysis(ULConfig config, bool enabled);
+
 ///
 /// Set the amount of time to wait before triggering another repaint when a CSS animation is active.
 /// (Default = 1.0 / 60.0)
@@ -127,6 +155,28 @@ ULExport void ulConfigSetMinSmallHeapSize(ULConfig config, unsigned int size);
 ///
 ULExport void ulConfigSetNumRendererThreads(ULConfig config, unsigned int num_renderer_threads);
 
+///
+/// Set whether or not to rasterize newly-needed glyphs in parallel on the renderer's worker
+/// threads. Glyphs are inserted into the glyph atlas in batches once per frame. (Default = True)
+///
+ULExport void ulConfigSetParallelGlyphRasterization(ULConfig config, bool enabled);
+
+///
+/// Set whether or not to draw glyphs that are not yet rasterized using a scaled version of the
+/// closest cached size for a frame while the final glyphs are rasterized in the background.
+/// This requires parallel glyph rasterization. (Default = False)
+///
+ULExport void ulConfigSetProgressiveGlyphRendering(ULConfig config, bool enabled);
+
+///
+/// The number of background threads to use for file system loads that are not handled by the
+/// open_file_async callback. Completed loads are delivered during the next call to ulUpdate().
+///
+/// @note  Your open_file callback must be thread-safe to use this. (Default = 0, all loads are
+///        performed synchronously on the main thread)
+///
+ULExport void ulConfigSetNumFileIOThreads(ULConfig config, unsigned int num_file_io_threads);
+
 ///
 /// The max amount of time (in seconds) to allow Renderer::Update to run per call. The library will
 /// attempt to throttle timers and/or reschedule work if this time budget is exceeded. (Default =
@@ -153,6 +203,55 @@ ULExport void ulConfigSetMaxUpdateTime(ULConfig config, double max_update_time);
 ///
 ULExport void ulConfigSetBitmapAlignment(ULConfig config, double bitmap_alignment);
 
+///
+/// The max amount of GPU memory (in bytes) to allocate through the GPUDriver for textures, render
+/// buffers, and geometry. Cached image and glyph textures are evicted (least recently used first)
+/// when this budget is exceeded, @see ulSetGPUMemoryBudgetExceededCallback.
+///
+/// (Default = 0, no limit)
+///
+ULExport void ulConfigSetGPUMemoryBudget(ULConfig config, unsigned long long budget);
+
+///
+/// The max width and height (in pixels) of an accelerated View whose render target may be packed
+/// into a shared atlas texture along with other small Views. Atlased Views are repacked when
+/// resized, so you should re-query ulViewGetRenderTarget() after each call to ulRender().
+///
+/// (Default = 0, every View gets its own render buffer)
+///
+ULExport void ulConfigSetRenderTargetAtlasMaxViewSize(ULConfig config, unsigned int size);
+
+///
+/// The width and height (in pixels) of each shared render target atlas texture. (Default = 2048)
+///
+ULExport void ulConfigSetRenderTargetAtlasSize(ULConfig config, unsigned int size);
+
+///
+/// The max amount of vertex/index data (in bytes) to retain across frames for unchanged content.
+/// When a layer repaints, unchanged display-list items reuse their existing geometry and only
+/// modified items are re-emitted to the GPUDriver.
+///
+/// Set this to 0 to disable the cache. (Default = 8 * 1024 * 1024)
+///
+ULExport void ulConfigSetGeometryCacheSize(ULConfig config, unsigned int size);
+
+///
+/// The max amount of tessellated path data (in bytes) to keep in the path cache. Paths are
+/// tessellated once per shape and scale bucket and reused by every instance of that shape.
+///
+/// Set this to 0 to disable the cache. (Default = 4 * 1024 * 1024)
+///
+ULExport void ulConfigSetPathCacheSize(ULConfig config, unsigned int size);
+
+///
+/// The max amount of text shaping results (in bytes) to keep in the shaping cache. Shaped runs are
+/// cached process-wide, keyed by text, font, font size, font features, text direction, script, and
+/// language, so identical text in the same context in different views is only shaped once.
+///
+/// Set this to 0 to disable the cache. (Default = 2 * 1024 * 1024)
+///
+ULExport void ulConfigSetTextShapingCacheSize(ULConfig config, unsigned int size);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -52,6 +52,8 @@ typedef struct C_ScrollEvent* ULScrollEvent;
 typedef struct C_Surface* ULSurface;
 typedef struct C_Surface* ULBitmapSurface;
 typedef struct C_FontFile* ULFontFile;
+typedef struct C_FileRequest* ULFileRequest;
+typedef struct C_FallbackFontRuns* ULFallbackFontRuns;
 
 typedef enum {
   kMessageSource_XML = 0,
@@ -50,13 +50,89 @@ typedef ULString (*ULFileSystemGetFileCharsetCallback)(ULString path);
 ///
 typedef ULBuffer (*ULFileSystemOpenFileCallback)(ULString path);
 
+///
+/// Begin opening a file for reading without blocking the calling thread.
+///
+/// You should start the load and return immediately, then call ulFileRequestComplete() (from any
+/// thread) when the data is ready. The result is delivered at the next call to ulUpdate().
+///
+/// Return true if you will complete the request. The file_exists, get_file_mime_type,
+/// get_file_charset, and open_file callbacks are then not called for this request, pass the
+/// mime-type and charset to ulFileRequestComplete() instead.
+///
+/// Return false to have the library fall back to those callbacks (called on the library's I/O
+/// threads if ulConfigSetNumFileIOThreads() is non-zero).
+///
+/// The request stays valid until you call ulFileRequestComplete() on it. If you return false, the
+/// request is invalid as soon as this callback returns and must not be used.
+///
+/// @note  This callback is optional, if it is NULL the library will always use open_file.
+///
+typedef bool (*ULFileSystemOpenFileAsyncCallback)(ULString path, ULFileRequest request);
+
+///
+/// Get the last modification time of a file (in seconds since the Unix epoch), used to invalidate
+/// cached file data. Return false if the modification time is unavailable.
+///
+/// @note  This callback is optional.
+///
+typedef bool (*ULFileSystemGetFileModificationTimeCallback)(ULString path, long long* result);
+
+///
+/// Get the size of a file in bytes. Return false if the size is unavailable or ranged reads are
+/// not supported.
+///
+/// @note  This callback is optional, implement it along with read_file_range to let large files
+///        be consumed incrementally instead of being loaded entirely via open_file.
+///
+typedef bool (*ULFileSystemGetFileSizeCallback)(ULString path, long long* result);
+
+///
+/// Read up to 'length' bytes from a file, starting at 'offset', into a Buffer. Return NULL if the
+/// read failed.
+///
+/// @note  This is only called if get_file_size returned true for the path.
+///
+/// @note  The returned data should be aligned to a 16-byte boundary, the same as open_file. The
+///        ICU data file is never read through this callback (it is always loaded via open_file).
+///
+typedef ULBuffer (*ULFileSystemReadFileRangeCallback)(ULString path, long long offset,
+                                                      size_t length);
+
+///
+/// File system callbacks.
+///
+/// @note  Some callbacks in this struct are optional (NULL means not implemented), you must
+///        zero-initialize the struct before setting the callbacks you implement so that unused
+///        and newly-added callbacks are NULL (eg, `ULFileSystem fs = { 0 };` or memset).
+///
 typedef struct {
   ULFileSystemFileExistsCallback file_exists;
   ULFileSystemGetFileMimeTypeCallback get_file_mime_type;
   ULFileSystemGetFileCharsetCallback get_file_charset;
   ULFileSystemOpenFileCallback open_file;
+  ULFileSystemOpenFileAsyncCallback open_file_async;
+  ULFileSystemGetFileModificationTimeCallback get_file_modification_time;
+  ULFileSystemGetFileSizeCallback get_file_size;
+  ULFileSystemReadFileRangeCallback read_file_range;
 } ULFileSystem;
 
+///
+/// Complete a pending asynchronous file load with the file contents (pass NULL if the file does not
+/// exist or could not be opened). The library takes ownership of the buffer.
+///
+/// @param  mime_type  The mime-type of the file (eg "text/html"), pass NULL or an empty string to
+///                    have the library determine it from the file extension.
+///
+/// @param  charset    The charset of the file (eg "utf-8"), pass NULL or an empty string to have
+///                    the library detect it from the file contents.
+///
+/// This is safe to call from any thread. The request is released by this call and must not be
+/// used afterwards.
+///
+ULExport void ulFileRequestComplete(ULFileRequest request, ULBuffer buffer, ULString mime_type,
+                                    ULString charset);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
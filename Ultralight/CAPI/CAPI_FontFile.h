@@ -10,17 +10,31 @@ extern "C" {
 #endif
 
 ///
-/// Create a font file from an on-disk file path.
+/// Create a font file from an on-disk file path. The file will be memory-mapped when it is first
+/// used.
 ///
 /// @note  The file path should already exist.
 ///
+/// @note  Font files are shared process-wide, an existing font file with the same full path is
+///        reused (on-disk fonts are only matched by path, they are never read in full to compare
+///        their content).
+///
 ULExport ULFontFile ulFontFileCreateFromFilePath(ULString file_path);
 
 ///
 /// Create a font file from an in-memory buffer.
 ///
+/// @note  Font files are shared process-wide, an existing in-memory font file with identical
+///        content (compared byte-for-byte) is reused.
+///
 ULExport ULFontFile ulFontFileCreateFromBuffer(ULBuffer buffer);
 
+///
+/// Get the number of bytes of memory used by a font file (font data held in memory plus its parsed
+/// face, not including memory-mapped data).
+///
+ULExport size_t ulFontFileGetMemoryUsage(ULFontFile font_file);
+
 ///
 /// Destroy font file
 ///
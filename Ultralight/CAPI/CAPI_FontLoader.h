@@ -53,12 +53,54 @@ typedef ULString (*ULFontLoaderGetFallbackFontForCharacters)(ULString characters
 ///
 typedef ULFontFile (*ULFontLoaderLoad)(ULString family, int weight, bool italic);
 
+///
+/// Fallback font family names for an entire string of text, split into runs that can each be
+/// rendered with a single font family.
+///
+/// @param  text    The text to find fallback fonts for.
+///
+/// @param  weight  Font weight.
+///
+/// @param  italic  Whether or not italic is requested.
+///
+/// @param  runs    An empty list to append runs to via ulFallbackFontRunsAppend(). Runs should be
+///                 in order and cover the entire text.
+///
+/// @return  Return false if batch queries are not supported, the library will call
+///          get_fallback_font_for_characters instead.
+///
+/// @note  This callback is optional.
+///
+typedef bool (*ULFontLoaderGetFallbackFontsForText)(ULString text, int weight, bool italic,
+                                                    ULFallbackFontRuns runs);
+
+///
+/// Font loader callbacks.
+///
+/// @note  Some callbacks in this struct are optional (NULL means not implemented), you must
+///        zero-initialize the struct before setting the callbacks you implement so that unused
+///        and newly-added callbacks are NULL (eg, `ULFontLoader loader = { 0 };` or memset).
+///
 typedef struct {
   ULFontLoaderGetFallbackFont get_fallback_font;
   ULFontLoaderGetFallbackFontForCharacters get_fallback_font_for_characters;
   ULFontLoaderLoad load;
+  ULFontLoaderGetFallbackFontsForText get_fallback_fonts_for_text;
 } ULFontLoader;
 
+///
+/// Append a run to a list of fallback font runs.
+///
+/// @param  offset  The start of the run within the text (in UTF-16 code units).
+///
+/// @param  length  The length of the run (in UTF-16 code units).
+///
+/// @param  family  A font family name that can render every character in the run (a copy is
+///                 made, you should destroy this string if you created it).
+///
+ULExport void ulFallbackFontRunsAppend(ULFallbackFontRuns runs, unsigned int offset,
+                                       unsigned int length, ULString family);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
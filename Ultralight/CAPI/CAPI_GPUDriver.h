@@ -58,6 +58,56 @@ typedef struct {
   float data6[4];
 } ULVertex_2f_4ub_2f_2f_28f;
 
+///
+/// Compact vertex layout for quad vertices (used when ULGPUDriverCaps::supports_compact_vertices
+/// is true).
+///
+/// Texture coordinates are 16-bit unsigned normalized integers and the data slots are IEEE 754
+/// half-precision floats.
+///
+/// Normalized values (colors, gradient stop offsets) are stored with an error below 1/2048 and
+/// small integers (fill types, flags) are exact. Pixel-space values in the data slots (gradient
+/// endpoints, rounded-rect sizes and radii, stroke widths) must survive an f32 -> f16 -> f32 round
+/// trip unchanged-- this format is only emitted for quads where they all do, other quads use
+/// kVertexBufferFormat_2f_4ub_2f_2f_28f. The pos and obj members are always full precision.
+///
+/// (this struct's members aligned on single-byte boundaries)
+///
+typedef struct {
+  float pos[2];
+  unsigned char color[4];
+  unsigned short tex[2];
+  float obj[2];
+  unsigned short data0[4];
+  unsigned short data1[4];
+  unsigned short data2[4];
+  unsigned short data3[4];
+  unsigned short data4[4];
+  unsigned short data5[4];
+  unsigned short data6[4];
+} ULVertex_2f_4ub_2us_2f_28h;
+
+///
+/// Per-instance layout for instanced quads (used when ULGPUDriverCaps::supports_instanced_quads
+/// is true). Each instance describes an entire quad, rects are stored as {left, top, right,
+/// bottom}. The same precision rules as ULVertex_2f_4ub_2us_2f_28h apply to the data slots.
+///
+/// (this struct's members aligned on single-byte boundaries)
+///
+typedef struct {
+  float pos[4];
+  unsigned char color[4];
+  unsigned short tex[4];
+  float obj[4];
+  unsigned short data0[4];
+  unsigned short data1[4];
+  unsigned short data2[4];
+  unsigned short data3[4];
+  unsigned short data4[4];
+  unsigned short data5[4];
+  unsigned short data6[4];
+} ULQuadInstance_4f_4ub_4us_4f_28h;
+
 ///
 /// End single-byte alignment.
 ///
@@ -69,6 +119,8 @@ typedef struct {
 typedef enum {
   kVertexBufferFormat_2f_4ub_2f,
   kVertexBufferFormat_2f_4ub_2f_2f_28f,
+  kVertexBufferFormat_2f_4ub_2us_2f_28h,
+  kVertexBufferFormat_Instance_4f_4ub_4us_4f_28h,
 } ULVertexBufferFormat;
 
 ///
@@ -85,12 +137,29 @@ typedef struct {
 ///
 typedef unsigned int ULIndexType;
 
+///
+/// Compact vertex index type (used when ULGPUDriverCaps::supports_16bit_indices is true).
+///
+typedef unsigned short ULIndexType16;
+
+///
+/// Vertex index formats.
+///
+typedef enum {
+  kIndexFormat_UInt32,
+  kIndexFormat_UInt16,
+} ULIndexFormat;
+
 ///
 /// Vertex index buffer data.
 ///
+/// @note  Geometry using kVertexBufferFormat_Instance_4f_4ub_4us_4f_28h has no index buffer (size
+///        will be 0).
+///
 typedef struct {
   unsigned int size;
   unsigned char* data;
+  ULIndexFormat format;
 } ULIndexBuffer;
 
 ///
@@ -101,7 +170,8 @@ typedef struct {
 ///
 typedef enum {
   kShaderType_Fill,     // Shader program for quad geometry
-  kShaderType_FillPath, // Shader program for path geometry
+  kShaderType_FillPath, // Shader program for path geometry (may be shared by several draws,
+                        // each with its own ULGPUState::transform)
 } ULShaderType;
 
 ///
@@ -157,6 +227,10 @@ typedef struct {
   unsigned int texture_3_id;
 
   /// The following four members are passed to the pixel shader via uniforms.
+  ///
+  /// If ULGPUDriverCaps::supports_scissor_clipping is set, the clip matrices are only used for
+  /// rounded or transformed clips-- axis-aligned clips that are snapped to the pixel grid are
+  /// lowered to scissor_rect instead (clip_size will be 0 if there are no other clips).
   float uniform_scalar[8];
   ULvec4 uniform_vector[8];
   unsigned char clip_size;
@@ -164,6 +238,9 @@ typedef struct {
 
   /// Whether or not scissor testing should be used for the current draw
   /// command.
+  ///
+  /// If ULGPUDriverCaps::supports_scissor_clipping is set, this is also used to apply axis-aligned
+  /// clips to draw commands.
   bool enable_scissor;
 
   /// The scissor rect to use for scissor testing (units in pixels)
@@ -189,6 +266,11 @@ typedef struct {
   unsigned int geometry_id;    // The geometry ID to bind
   unsigned int indices_count;  // The number of indices
   unsigned int indices_offset; // The index to start from
+
+  /// The following members are only used when drawing geometry with an instanced vertex format
+  /// (indices_count and indices_offset are unused in this case).
+  unsigned int instance_count;  // The number of quad instances to draw
+  unsigned int instance_offset; // The instance to start from
 } ULCommand;
 
 ///
@@ -198,6 +280,35 @@ typedef struct {
   ULCommand* commands;
 } ULCommandList;
 
+///
+/// Optional features supported by a GPUDriver, @see ULGPUDriverGetCapsCallback
+///
+typedef struct {
+  bool supports_compact_vertices; // Supports kVertexBufferFormat_2f_4ub_2us_2f_28h
+  bool supports_16bit_indices;    // Supports kIndexFormat_UInt16
+  bool supports_instanced_quads;  // Supports kVertexBufferFormat_Instance_4f_4ub_4us_4f_28h
+
+  /// The maximum number of frames the GPU may be executing at once. Values greater than 1 enable
+  /// the signal_frame_fence and get_last_completed_frame callbacks, and dynamic resources are
+  /// ring-buffered (one copy per frame in flight). (0 is treated as 1)
+  unsigned int max_frames_in_flight;
+
+  /// Whether the driver supports the readback_render_buffer callback.
+  bool supports_async_readback;
+
+  /// Whether the driver applies enable_scissor / scissor_rect to all draw commands (not just
+  /// scissored clears). When set, axis-aligned clips are lowered to the scissor rect.
+  bool supports_scissor_clipping;
+} ULGPUDriverCaps;
+
+///
+/// The callback invoked when the library wants to query the optional features supported by the
+/// GPUDriver. This is called once when the renderer is created.
+///
+/// @note  This callback is optional, if it is NULL no optional features will be used.
+///
+typedef ULGPUDriverCaps (*ULGPUDriverGetCapsCallback)();
+
 ///
 /// The callback invoked when the GPUDriver will begin dispatching commands (such as CreateTexture
 /// and UpdateCommandList) during the current call to ulRender().
@@ -210,6 +321,27 @@ typedef void (*ULGPUDriverBeginSynchronizeCallback)();
 ///
 typedef void (*ULGPUDriverEndSynchronizeCallback)();
 
+///
+/// The callback invoked after end_synchronize to mark the end of all commands dispatched for a
+/// certain frame. You should insert a fence into your GPU command stream here.
+///
+/// @note  This is only called if ULGPUDriverCaps::max_frames_in_flight is greater than 1.
+///
+typedef void (*ULGPUDriverSignalFrameFenceCallback)(unsigned long long frame_index);
+
+///
+/// The callback invoked when the library wants to know the index of the most recent frame that
+/// the GPU has finished executing (or 0 if none). This should not block.
+///
+/// The library will not update or destroy any resource used by a frame with a greater index.
+/// Resources updated every frame (eg, the glyph atlas and dynamic geometry) are instead renamed:
+/// one copy (with its own ID) is kept per frame in flight and updates target a copy the GPU is no
+/// longer using. Destroy calls are deferred until the frame using the resource completes.
+///
+/// @note  This is only called if ULGPUDriverCaps::max_frames_in_flight is greater than 1.
+///
+typedef unsigned long long (*ULGPUDriverGetLastCompletedFrameCallback)();
+
 ///
 /// The callback invoked when the GPUDriver wants to get the next available texture ID.
 ///
@@ -230,6 +362,19 @@ typedef void (*ULGPUDriverCreateTextureCallback)(unsigned int texture_id, ULBitm
 ///
 typedef void (*ULGPUDriverUpdateTextureCallback)(unsigned int texture_id, ULBitmap bitmap);
 
+///
+/// The callback invoked when the GPUDriver wants to update one or more regions of an existing
+/// non-RTT texture with new bitmap data.
+///
+/// Only the pixels within 'dirty_rects' have changed (units in pixels, clipped to the bitmap
+/// bounds and non-overlapping), you can upload each rect via glTexSubImage2D or similar.
+///
+/// @note  This callback is optional, if it is NULL the library will call update_texture instead.
+///
+typedef void (*ULGPUDriverUpdateTextureRegionsCallback)(unsigned int texture_id, ULBitmap bitmap,
+                                                        const ULIntRect* dirty_rects,
+                                                        unsigned int num_dirty_rects);
+
 ///
 /// The callback invoked when the GPUDriver wants to destroy a texture.
 ///
@@ -282,6 +427,37 @@ typedef void (*ULGPUDriverDestroyGeometryCallback)(unsigned int geometry_id);
 ///
 typedef void (*ULGPUDriverUpdateCommandListCallback)(ULCommandList list);
 
+///
+/// The completion callback passed to ULGPUDriverReadbackRenderBufferCallback.
+///
+/// @param  context  The opaque context passed to the readback callback.
+///
+/// @param  bitmap   The pixels that were read back, or NULL if the readback failed. The library
+///                  takes ownership of this bitmap.
+///
+typedef void (*ULGPUDriverReadbackCompleteCallback)(void* context, ULBitmap bitmap);
+
+///
+/// The callback invoked when the library wants an asynchronous copy of a render buffer's pixels.
+///
+/// The copy should be performed after all commands in the current command list have executed
+/// without stalling the pipeline (eg, via a staging buffer or PBO). You must invoke 'callback'
+/// exactly once, on the thread the renderer was created on (eg, during a later
+/// begin_synchronize).
+///
+/// @note  This is only called if ULGPUDriverCaps::supports_async_readback is true.
+///
+typedef void (*ULGPUDriverReadbackRenderBufferCallback)(
+    unsigned int render_buffer_id, ULIntRect rect, ULGPUDriverReadbackCompleteCallback callback,
+    void* context);
+
+///
+/// GPU driver callbacks.
+///
+/// @note  Some callbacks in this struct are optional (NULL means not implemented), you must
+///        zero-initialize the struct before setting the callbacks you implement so that unused
+///        and newly-added callbacks are NULL (eg, `ULGPUDriver driver = { 0 };` or memset).
+///
 typedef struct {
   ULGPUDriverBeginSynchronizeCallback begin_synchronize;
   ULGPUDriverEndSynchronizeCallback end_synchronize;
@@ -297,6 +473,11 @@ typedef struct {
   ULGPUDriverUpdateGeometryCallback update_geometry;
   ULGPUDriverDestroyGeometryCallback destroy_geometry;
   ULGPUDriverUpdateCommandListCallback update_command_list;
+  ULGPUDriverUpdateTextureRegionsCallback update_texture_regions;
+  ULGPUDriverGetCapsCallback get_caps;
+  ULGPUDriverSignalFrameFenceCallback signal_frame_fence;
+  ULGPUDriverGetLastCompletedFrameCallback get_last_completed_frame;
+  ULGPUDriverReadbackRenderBufferCallback readback_render_buffer;
 } ULGPUDriver;
 
 ///
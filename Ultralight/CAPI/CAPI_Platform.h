@@ -45,6 +45,9 @@ ULExport void ulPlatformSetLogger(ULLogger logger);
 ///        default platform file system by calling ulEnablePlatformFileSystem()'
 ///        (@see <AppCore/CAPI.h>)
 ///
+/// @note  The ULFileSystem struct must be zero-initialized before setting its callbacks, optional
+///        callbacks that are left NULL are treated as not implemented.
+///
 ULExport void ulPlatformSetFileSystem(ULFileSystem file_system);
 
 ///
@@ -72,6 +75,9 @@ ULExport void ulPlatformSetSurfaceDefinition(ULSurfaceDefinition surface_definit
 ///
 /// You should call this before ulCreateRenderer().
 ///
+/// @note  The ULGPUDriver struct must be zero-initialized before setting its callbacks, optional
+///        callbacks that are left NULL are treated as not implemented.
+///
 ULExport void ulPlatformSetGPUDriver(ULGPUDriver gpu_driver);
 
 ///
@@ -57,10 +57,99 @@ ULExport void ulRender(ULRenderer renderer);
 ULExport void ulPurgeMemory(ULRenderer renderer);
 
 ///
-/// Print detailed memory usage statistics to the log. (@see ulPlatformSetLogger)
+/// Print detailed memory usage statistics to the log, including the memory used by each loaded
+/// font file. (@see ulPlatformSetLogger)
 ///
 ULExport void ulLogMemoryUsage(ULRenderer renderer);
 
+///
+/// Write all glyphs rasterized so far to the on-disk glyph cache so they can be reused on the next
+/// launch. (@see ulConfigSetEnableGlyphCachePersistence)
+///
+/// @return  Returns whether the glyph cache was written successfully or not.
+///
+ULExport bool ulSaveGlyphCache(ULRenderer renderer);
+
+///
+/// Rasterize the glyphs listed in a manifest on a background thread so they are ready before they
+/// are first drawn. Each line of the manifest is formatted as:
+/// <pre>
+///   <font-family>;<weight>;<italic (0 or 1)>;<size in pixels>;<characters>
+/// </pre>
+///
+/// @param  manifest_path  The path of the manifest, relative to the file system root.
+///
+ULExport void ulPrewarmGlyphCache(ULRenderer renderer, ULString manifest_path);
+
+///
+/// Runtime statistics for the renderer (see <Ultralight/Stats.h>).
+///
+/// Members prefixed with `last_frame_` describe the most recent call to ulRender(). Other members
+/// are cumulative since the renderer was created unless they describe current usage.
+///
+typedef struct {
+  unsigned int last_frame_texture_updates;
+  unsigned long long last_frame_texture_bytes_uploaded;
+  unsigned long long last_frame_texture_bytes_total;
+  unsigned int last_frame_draw_commands;
+  unsigned int last_frame_scissor_clipped_draws;
+  unsigned int last_frame_matrix_clipped_draws;
+  unsigned int last_frame_glyphs_rasterized;
+  unsigned int last_frame_glyphs_pending;
+  double last_frame_glyph_wait_time;
+  double startup_time;
+  double startup_time_icu;
+  double startup_time_fonts;
+  double startup_time_javascript;
+  double time_to_first_view;
+  unsigned long long texture_updates;
+  unsigned long long texture_bytes_uploaded;
+  unsigned long long gpu_memory_bytes;
+  unsigned long long gpu_texture_bytes;
+  unsigned long long gpu_render_buffer_bytes;
+  unsigned long long gpu_geometry_bytes;
+  unsigned long long gpu_bytes_evicted;
+  unsigned int render_target_atlas_count;
+  unsigned int render_target_atlas_views;
+  float render_target_atlas_fragmentation;
+  unsigned long long render_target_atlas_repacks;
+  unsigned long long geometry_cache_hits;
+  unsigned long long geometry_cache_misses;
+  unsigned long long geometry_cache_bytes;
+  unsigned long long path_cache_hits;
+  unsigned long long path_cache_misses;
+  unsigned long long path_cache_bytes;
+  unsigned long long font_fallback_cache_hits;
+  unsigned long long font_fallback_cache_misses;
+  unsigned int font_file_count;
+  unsigned long long font_memory_bytes;
+  unsigned long long glyph_cache_hits;
+  unsigned long long glyph_cache_misses;
+  unsigned long long glyph_cache_disk_loads;
+  unsigned long long shaping_cache_hits;
+  unsigned long long shaping_cache_misses;
+  unsigned long long shaping_cache_bytes;
+} ULRendererStats;
+
+///
+/// Get runtime statistics for the renderer (texture upload sizes, etc.).
+///
+/// @note  These values are updated at the end of each call to ulRender().
+///
+ULExport ULRendererStats ulGetRendererStats(ULRenderer renderer);
+
+typedef void (*ULGPUMemoryBudgetExceededCallback)(void* user_data, ULRenderer caller,
+                                                  unsigned long long bytes_in_use,
+                                                  unsigned long long budget);
+
+///
+/// Set callback for when GPU memory usage is still over the budget set via
+/// ulConfigSetGPUMemoryBudget() after evicting all evictable cached textures.
+///
+ULExport void ulSetGPUMemoryBudgetExceededCallback(ULRenderer renderer,
+                                                   ULGPUMemoryBudgetExceededCallback callback,
+                                                   void* user_data);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
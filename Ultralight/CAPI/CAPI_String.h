@@ -61,6 +61,20 @@ ULExport void ulStringAssignString(ULString str, ULString new_str);
 ///
 ULExport void ulStringAssignCString(ULString str, const char* c_str);
 
+///
+/// A non-owning view of a UTF-8 string (not necessarily null-terminated).
+///
+typedef struct {
+  const char* data;
+  size_t length;
+} ULStringView;
+
+///
+/// Get a view of a string's native UTF-8 buffer data, the view is only valid as long as the
+/// string is alive and unmodified.
+///
+ULExport ULStringView ulStringGetView(ULString str);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
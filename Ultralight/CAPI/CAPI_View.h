@@ -2,6 +2,8 @@
 #define ULTRALIGHT_CAPI_VIEW_H
 
 #include <Ultralight/CAPI/CAPI_Defines.h>
+#include <Ultralight/CAPI/CAPI_String.h>
+#include <Ultralight/CAPI/CAPI_Buffer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -185,11 +187,87 @@ ULExport ULRenderTarget ulViewGetRenderTarget(ULView view);
 ///
 ULExport ULSurface ulViewGetSurface(ULView view);
 
+///
+/// Runtime statistics for a View (see <Ultralight/Stats.h>).
+///
+typedef struct {
+  unsigned long long gpu_memory_bytes;
+} ULViewStats;
+
+///
+/// Get runtime statistics for the View (GPU memory usage, etc.).
+///
+/// @note  These values are updated at the end of each call to ulRender().
+///
+ULExport ULViewStats ulViewGetStats(ULView view);
+
+///
+/// Analysis of the GPU command list generated for a View's last frame (see <Ultralight/Stats.h>).
+///
+typedef struct {
+  unsigned int draw_commands;
+  unsigned int redundant_binds;
+  unsigned int tiny_draws;
+  unsigned int blended_draws_over_opaque;
+  unsigned long long pixels_shaded;
+  unsigned long long pixels_covered;
+  float average_overdraw;
+  unsigned int max_overdraw;
+
+  /// Per-pixel overdraw heat-map (kBitmapFormat_A8_UNORM), each pixel stores the number of times
+  /// it was shaded (saturated at 255). May be NULL. Don't destroy this, it's owned by the View.
+  ULBitmap overdraw_map;
+} ULFrameAnalysis;
+
+///
+/// Get the analysis of the GPU command list generated for the last frame rendered for this View.
+///
+/// @note  This is only computed when enabled via ulConfigSetEnableFrameAnalysis(), otherwise all
+///        values will be zero and the overdraw map will be NULL.
+///
+ULExport ULFrameAnalysis ulViewGetFrameAnalysis(ULView view);
+
+typedef void (*ULCaptureFrameCallback)(void* user_data, ULView caller, ULBitmap bitmap);
+
+///
+/// Capture the pixels of the next frame rendered for this View into a bitmap, without stalling
+/// rendering.
+///
+/// @param  rect  The sub-rect to capture (units in pixels), pass an empty rect to capture the
+///               entire View.
+///
+/// @note  The callback is invoked during a later call to ulUpdate() or ulRender(). The bitmap
+///        passed to the callback is NULL if the capture failed. Don't destroy it, it's owned by
+///        the View-- use ulCreateBitmapFromCopy() if you need to keep it.
+///
+ULExport void ulViewCaptureNextFrame(ULView view, ULIntRect rect, ULCaptureFrameCallback callback,
+                                     void* user_data);
+
 ///
 /// Load a raw string of HTML.
 ///
 ULExport void ulViewLoadHTML(ULView view, ULString html_string);
 
+///
+/// Load a raw string of HTML (UTF-8) without copying it into a ULString first. The data is only
+/// read during this call.
+///
+ULExport void ulViewLoadHTMLStringView(ULView view, ULStringView html);
+
+///
+/// Load HTML from a buffer without copying it into a string first. The data is fed to the HTML
+/// parser directly (incrementally, in chunks).
+///
+/// @param  html     The raw HTML data to load. The view takes its own reference, you can destroy
+///                  the buffer after this call (the data should not be modified until the load
+///                  has finished).
+///
+/// @param  url      An optional URL for this load (pass NULL or an empty string for none).
+///
+/// @param  charset  The text encoding of the data (pass NULL to use "utf-8").
+///
+ULExport void ulViewLoadHTMLFromBuffer(ULView view, ULBuffer html, ULString url, ULString charset);
+
 ///
 /// Load a URL into main frame.
 ///
@@ -241,6 +319,13 @@ ULExport void ulViewUnlockJSContext(ULView view);
 ///
 ULExport ULString ulViewEvaluateScript(ULView view, ULString js_string, ULString* exception);
 
+///
+/// Evaluate a string of JavaScript (UTF-8) without copying it into a ULString first, the data is
+/// only read during this call. @see ulViewEvaluateScript
+///
+ULExport ULString ulViewEvaluateScriptStringView(ULView view, ULStringView js_string,
+                                                 ULString* exception);
+
 ///
 /// Check if can navigate backwards in history.
 ///
@@ -27,6 +27,11 @@ namespace ultralight {
 /// display on a 3D quad in your application. This struct provides all the details you need to
 /// display the corresponding texture in your application.
 ///
+/// @note  Small Views may share a single atlas texture and render buffer with other Views (see
+///        Config::render_target_atlas_max_view_size). In that case uv_coords describes the
+///        View's region within the atlas (padded by a 1-pixel transparent gutter), and the
+///        texture and UVs may change whenever the atlas is repacked.
+///
 struct UExport RenderTarget {
   ///
   /// Whether this target is empty (null texture)
@@ -50,12 +55,12 @@ struct UExport RenderTarget {
   uint32_t texture_id;
 
   ///
-  /// The texture width (in pixels). This may be padded.
+  /// The texture width (in pixels). This may be padded or be the width of a shared atlas.
   ///
   uint32_t texture_width;
 
   ///
-  /// The texture height (in pixels). This may be padded.
+  /// The texture height (in pixels). This may be padded or be the height of a shared atlas.
   ///
   uint32_t texture_height;
 
@@ -65,7 +70,7 @@ struct UExport RenderTarget {
   BitmapFormat texture_format;
 
   ///
-  /// UV coordinates of the texture (this is needed because the texture may be padded).
+  /// UV coordinates of the texture (this is needed because the texture may be padded or shared).
   ///
   Rect uv_coords;
 
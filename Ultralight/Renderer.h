@@ -16,10 +16,34 @@
 #include <Ultralight/RefPtr.h>
 #include <Ultralight/Session.h>
 #include <Ultralight/View.h>
+#include <Ultralight/Stats.h>
 #include <Ultralight/GamepadEvent.h>
 
 namespace ultralight {
 
+///
+/// @brief  Interface for Renderer-related events
+///
+/// @note   For more info @see Renderer::set_listener
+///
+class UExport RendererListener {
+ public:
+  virtual ~RendererListener() { }
+
+  ///
+  /// Called when GPU memory usage is still over Config::gpu_memory_budget after evicting all
+  /// evictable cached textures.
+  ///
+  /// You can respond by reducing the size or number of accelerated Views, or by calling
+  /// Renderer::PurgeMemory (outside of this callback).
+  ///
+  /// @param  bytes_in_use  The estimated number of bytes of GPU memory currently allocated.
+  ///
+  /// @param  budget        The budget set in Config::gpu_memory_budget.
+  ///
+  virtual void OnGPUMemoryBudgetExceeded(uint64_t bytes_in_use, uint64_t budget) { }
+};
+
 ///
 /// @brief  This singleton manages the lifetime of all Views (@see View) and coordinates
 ///         painting, network requests, and event dispatch.
@@ -49,6 +73,8 @@ class UExport Renderer : public RefCounted {
   ///
   /// @note  You should only create one Renderer per application lifetime.
   ///
+  /// @note  A breakdown of the time spent in this call is available via Renderer::stats.
+  ///
   /// @note: You should not call this if you are using App::Create(), it creates its own renderer
   ///        and provides default implementations for various platform handlers automatically.
   ///
@@ -122,11 +148,61 @@ class UExport Renderer : public RefCounted {
   virtual void PurgeMemory() = 0;
 
   ///
-  /// Print detailed memory usage statistics to the log.
-  /// (@see Platform::set_logger())
+  /// Print detailed memory usage statistics to the log, including the memory used by each
+  /// loaded font file. (@see Platform::set_logger())
   ///
   virtual void LogMemoryUsage() = 0;
 
+  ///
+  /// Write all glyphs rasterized so far to the on-disk glyph cache, they will be reused on the
+  /// next launch instead of being rasterized again. You should call this once your UI has warmed
+  /// up (eg, after the first few frames have been painted).
+  ///
+  /// Entries are keyed by FontFile::content_hash (@see Config::enable_glyph_cache_persistence).
+  ///
+  /// @note  This requires Config::enable_glyph_cache_persistence.
+  ///
+  /// @return  Returns whether the glyph cache was written successfully or not.
+  ///
+  virtual bool SaveGlyphCache() = 0;
+
+  ///
+  /// Rasterize a set of glyphs on a background thread so they are ready before they are first
+  /// drawn. Glyphs that are already in the (in-memory or on-disk) glyph cache are skipped.
+  ///
+  /// The manifest is a UTF-8 text file loaded through the FileSystem, each line describes one
+  /// font face and size followed by the characters to rasterize:
+  /// <pre>
+  ///   <font-family>;<weight>;<italic (0 or 1)>;<size in pixels>;<characters>
+  /// </pre>
+  /// For example:
+  /// <pre>
+  ///   Segoe UI;400;0;14;ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789
+  /// </pre>
+  ///
+  /// @param  manifest_path  The path of the manifest, relative to the FileSystem root.
+  ///
+  virtual void PrewarmGlyphCache(const String& manifest_path) = 0;
+
+  ///
+  /// Get runtime statistics for the Renderer (texture upload sizes, etc.).
+  ///
+  /// @note  These values are updated at the end of each call to Renderer::Render.
+  ///
+  virtual RendererStats stats() = 0;
+
+  ///
+  /// Set a RendererListener to receive callbacks for Renderer-related events.
+  ///
+  /// @note  Ownership remains with the caller.
+  ///
+  virtual void set_listener(RendererListener* listener) = 0;
+
+  ///
+  /// Get the active RendererListener, if any
+  ///
+  virtual RendererListener* listener() const = 0;
+
   ///
   /// Start the remote inspector server, Views that are loaded into this renderer
   /// will be able to be remotely inspected either locally (another app on same machine) or
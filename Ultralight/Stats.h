@@ -0,0 +1,329 @@
+///
+/// @file Stats.h
+///
+/// @brief The header for the RendererStats, ViewStats, and FrameAnalysis structs.
+///
+/// @author
+///
+/// This file is a part of Ultralight, a next-generation HTML renderer.
+///
+/// Website: <http://ultralig.ht>
+///
+/// Copyright (C) 2022 Ultralight, Inc. All rights reserved.
+///
+#pragma once
+#include <Ultralight/Defines.h>
+#include <Ultralight/RefPtr.h>
+#include <Ultralight/Bitmap.h>
+
+namespace ultralight {
+
+#pragma pack(push, 1)
+
+///
+/// @brief  Runtime statistics for the Renderer, @see Renderer::stats
+///
+/// Members prefixed with `last_frame_` describe the most recent call to Renderer::Render. Other
+/// members are cumulative since the Renderer was created unless they describe current usage.
+///
+struct UExport RendererStats {
+  ///
+  /// The number of texture updates dispatched to the GPUDriver during the last frame.
+  ///
+  uint32_t last_frame_texture_updates = 0;
+
+  ///
+  /// The number of bytes of bitmap data marked dirty in texture updates during the last frame.
+  ///
+  /// This is the sum of the dirty rects passed to GPUDriver::UpdateTextureRegions (full texture
+  /// updates count the entire bitmap).
+  ///
+  uint64_t last_frame_texture_bytes_uploaded = 0;
+
+  ///
+  /// The number of bytes that would have been uploaded during the last frame if every texture
+  /// update re-uploaded the entire bitmap. Compare with last_frame_texture_bytes_uploaded to see
+  /// the savings from partial uploads.
+  ///
+  uint64_t last_frame_texture_bytes_total = 0;
+
+  ///
+  /// The number of draw commands dispatched to the GPUDriver during the last frame.
+  ///
+  uint32_t last_frame_draw_commands = 0;
+
+  ///
+  /// The number of draw commands during the last frame whose clips were all axis-aligned and
+  /// were applied via GPUState::scissor_rect only (no clip matrices). This is always 0 unless the
+  /// GPUDriver sets GPUDriverCaps::supports_scissor_clipping.
+  ///
+  uint32_t last_frame_scissor_clipped_draws = 0;
+
+  ///
+  /// The number of draw commands during the last frame that needed one or more clip matrices
+  /// (GPUState::clip_size > 0) for rounded or transformed clips.
+  ///
+  uint32_t last_frame_matrix_clipped_draws = 0;
+
+  ///
+  /// The number of glyphs rasterized during the last frame.
+  ///
+  uint32_t last_frame_glyphs_rasterized = 0;
+
+  ///
+  /// The number of glyphs drawn with a placeholder during the last frame because their final
+  /// version was still being rasterized, @see Config::progressive_glyph_rendering
+  ///
+  uint32_t last_frame_glyphs_pending = 0;
+
+  ///
+  /// The time (in seconds) the last frame spent waiting for glyph rasterization to finish.
+  ///
+  double last_frame_glyph_wait_time = 0.0;
+
+  ///
+  /// The total time (in seconds) spent in Renderer::Create.
+  ///
+  double startup_time = 0.0;
+
+  ///
+  /// The time (in seconds) spent during startup initializing ICU data and locale tables.
+  ///
+  double startup_time_icu = 0.0;
+
+  ///
+  /// The time (in seconds) spent during startup initializing the font loader and font caches.
+  ///
+  double startup_time_fonts = 0.0;
+
+  ///
+  /// The time (in seconds) spent during startup initializing the JavaScript VM.
+  ///
+  double startup_time_javascript = 0.0;
+
+  ///
+  /// The time (in seconds) from the start of Renderer::Create to the end of the first call to
+  /// Renderer::Render that painted a View, or 0 if no View has been painted yet.
+  ///
+  double time_to_first_view = 0.0;
+
+  ///
+  /// The total number of texture updates dispatched to the GPUDriver.
+  ///
+  uint64_t texture_updates = 0;
+
+  ///
+  /// The total number of bytes of bitmap data marked dirty in texture updates.
+  ///
+  uint64_t texture_bytes_uploaded = 0;
+
+  ///
+  /// The estimated number of bytes of GPU memory currently allocated through the GPUDriver (the
+  /// sum of gpu_texture_bytes, gpu_render_buffer_bytes, and gpu_geometry_bytes).
+  ///
+  uint64_t gpu_memory_bytes = 0;
+
+  ///
+  /// The estimated number of bytes used by textures (not including render buffer textures).
+  ///
+  uint64_t gpu_texture_bytes = 0;
+
+  ///
+  /// The estimated number of bytes used by render buffers and their backing textures.
+  ///
+  uint64_t gpu_render_buffer_bytes = 0;
+
+  ///
+  /// The estimated number of bytes used by vertex and index buffers.
+  ///
+  uint64_t gpu_geometry_bytes = 0;
+
+  ///
+  /// The total number of bytes of cached image and glyph textures evicted to stay within
+  /// Config::gpu_memory_budget.
+  ///
+  uint64_t gpu_bytes_evicted = 0;
+
+  ///
+  /// The number of shared render target atlases currently allocated, @see
+  /// Config::render_target_atlas_max_view_size
+  ///
+  uint32_t render_target_atlas_count = 0;
+
+  ///
+  /// The number of Views whose render targets are currently packed into a shared atlas.
+  ///
+  uint32_t render_target_atlas_views = 0;
+
+  ///
+  /// The fraction of allocated atlas area not used by any View (0.0 = fully packed, 1.0 =
+  /// empty). High values mean atlases will be repacked or released soon.
+  ///
+  float render_target_atlas_fragmentation = 0.0f;
+
+  ///
+  /// The total number of times a render target atlas was repacked (eg, after a View resize).
+  ///
+  uint64_t render_target_atlas_repacks = 0;
+
+  ///
+  /// The total number of display-list items drawn with retained geometry from a previous frame,
+  /// @see Config::geometry_cache_size
+  ///
+  uint64_t geometry_cache_hits = 0;
+
+  ///
+  /// The total number of display-list items whose geometry had to be re-tessellated and sent to
+  /// the GPUDriver.
+  ///
+  uint64_t geometry_cache_misses = 0;
+
+  ///
+  /// The number of bytes of vertex/index data currently retained in the geometry cache.
+  ///
+  uint64_t geometry_cache_bytes = 0;
+
+  ///
+  /// The total number of path draws that reused cached tessellated vertices, @see
+  /// Config::path_cache_size
+  ///
+  uint64_t path_cache_hits = 0;
+
+  ///
+  /// The total number of path draws that required a new tessellation.
+  ///
+  uint64_t path_cache_misses = 0;
+
+  ///
+  /// The number of bytes of tessellated path data currently held in the path cache.
+  ///
+  uint64_t path_cache_bytes = 0;
+
+  ///
+  /// The total number of fallback font lookups answered from the cache, @see
+  /// Config::cache_font_fallbacks
+  ///
+  uint64_t font_fallback_cache_hits = 0;
+
+  ///
+  /// The total number of fallback font lookups forwarded to the FontLoader (including lookups
+  /// where no cached family covered the requested characters).
+  ///
+  uint64_t font_fallback_cache_misses = 0;
+
+  ///
+  /// The number of unique font files currently loaded (shared by all Views), @see FontFile
+  ///
+  uint32_t font_file_count = 0;
+
+  ///
+  /// The number of bytes of memory used by all loaded font files (not including memory-mapped
+  /// font data), @see FontFile::memory_usage
+  ///
+  uint64_t font_memory_bytes = 0;
+
+  ///
+  /// The total number of glyph draws answered from the glyph cache (including glyphs loaded from
+  /// the on-disk glyph cache), @see Config::enable_glyph_cache_persistence
+  ///
+  uint64_t glyph_cache_hits = 0;
+
+  ///
+  /// The total number of glyphs that had to be rasterized.
+  ///
+  uint64_t glyph_cache_misses = 0;
+
+  ///
+  /// The total number of glyphs loaded from the on-disk glyph cache.
+  ///
+  uint64_t glyph_cache_disk_loads = 0;
+
+  ///
+  /// The total number of text runs whose shaping results were answered from the shaping cache,
+  /// @see Config::text_shaping_cache_size
+  ///
+  uint64_t shaping_cache_hits = 0;
+
+  ///
+  /// The total number of text runs that had to be shaped.
+  ///
+  uint64_t shaping_cache_misses = 0;
+
+  ///
+  /// The number of bytes of shaping results currently held in the shaping cache.
+  ///
+  uint64_t shaping_cache_bytes = 0;
+};
+
+///
+/// @brief  Runtime statistics for a single View, @see View::stats
+///
+struct UExport ViewStats {
+  ///
+  /// The estimated number of bytes of GPU memory used by this View (render buffers, textures,
+  /// and geometry owned by its layers). Resources shared between Views, such as the glyph atlas,
+  /// are not included.
+  ///
+  uint64_t gpu_memory_bytes = 0;
+};
+
+#pragma pack(pop)
+
+///
+/// @brief  Analysis of the GPU command list generated for a View's last frame, @see
+///         View::frame_analysis
+///
+/// @note  This is only computed when Config::enable_frame_analysis is true.
+///
+struct UExport FrameAnalysis {
+  ///
+  /// The number of draw commands in the frame.
+  ///
+  uint32_t draw_commands = 0;
+
+  ///
+  /// The number of draw commands that re-bound the same render buffer, textures, and shader as
+  /// the previous command (these could have been merged into a single draw).
+  ///
+  uint32_t redundant_binds = 0;
+
+  ///
+  /// The number of draw commands that covered fewer than 64 pixels.
+  ///
+  uint32_t tiny_draws = 0;
+
+  ///
+  /// The number of draw commands with blending enabled that only covered pixels already fully
+  /// covered by opaque content drawn earlier in the frame (blending could have been disabled or
+  /// the draw skipped).
+  ///
+  uint32_t blended_draws_over_opaque = 0;
+
+  ///
+  /// The number of pixels shaded by all draw commands.
+  ///
+  uint64_t pixels_shaded = 0;
+
+  ///
+  /// The number of unique pixels covered by at least one draw command.
+  ///
+  uint64_t pixels_covered = 0;
+
+  ///
+  /// The average number of times each covered pixel was shaded (pixels_shaded / pixels_covered).
+  ///
+  float average_overdraw = 0.0f;
+
+  ///
+  /// The max number of times any single pixel was shaded.
+  ///
+  uint32_t max_overdraw = 0;
+
+  ///
+  /// Per-pixel overdraw heat-map (BitmapFormat::A8_UNORM, same size as the View). Each pixel
+  /// stores the number of times it was shaded during the frame, saturated at 255.
+  ///
+  RefPtr<Bitmap> overdraw_map;
+};
+
+} // namespace ultralight
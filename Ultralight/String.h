@@ -46,6 +46,11 @@ public:
   ///
   String(const String8& str);
 
+  ///
+  /// Create from existing String8 (UTF-8), str is moved and left empty.
+  ///
+  String(String8&& str) noexcept;
+
   ///
   /// Create from raw UTF-16 string with certain length
   ///
@@ -66,6 +71,11 @@ public:
   ///
   String(const String& other);
 
+  ///
+  /// Move constructor, other is left empty
+  ///
+  String(String&& other) noexcept;
+
   ///
   /// Destructor
   ///
@@ -76,6 +86,11 @@ public:
   ///
   String& operator=(const String& other);
 
+  ///
+  /// Move string from another, other is left empty
+  ///
+  String& operator=(String&& other) noexcept;
+
   ///
   /// Append string with another
   ///
@@ -53,11 +53,17 @@ public:
   // Make a deep copy of String16
   String16(const String16& other);
 
+  // Move a String16 into this one, other is left empty
+  String16(String16&& other) noexcept;
+
   ~String16();
 
   // Assign a String16 to this one, deep copy is made
   String16& operator=(const String16& other);
 
+  // Move a String16 into this one, other is left empty
+  String16& operator=(String16&& other) noexcept;
+
   // Append a String16 to this one.
   String16& operator+=(const String16& other);
 
@@ -101,6 +107,19 @@ public:
   // Get a UTF-32 copy of this string
   String32 utf32() const;
 
+  // Get the length (in bytes) this string would have if converted to UTF-8
+  size_t utf8_length() const;
+
+  // Get the length (in code points) this string would have if converted to UTF-32
+  size_t utf32_length() const;
+
+  // Check if this string only contains ASCII characters
+  bool is_ascii() const;
+
+  // Check if this string is well-formed UTF-16 (no unpaired surrogates). Conversions replace
+  // unpaired surrogates with U+FFFD (replacement character).
+  bool is_valid_utf16() const;
+
 private:
   Char16* data_;
   size_t length_;
@@ -34,11 +34,17 @@ public:
   // Make a deep copy of String32
   String32(const String32& other);
 
+  // Move a String32 into this one, other is left empty
+  String32(String32&& other) noexcept;
+
   ~String32();
 
   // Assign a String32 to this one, deep copy is made
   String32& operator=(const String32& other);
 
+  // Move a String32 into this one, other is left empty
+  String32& operator=(String32&& other) noexcept;
+
   // Append a String32 to this one.
   String32& operator+=(const String32& other);
 
@@ -75,6 +81,12 @@ public:
   // Get a UTF-16 copy of this string
   String16 utf16() const;
 
+  // Get the length (in bytes) this string would have if converted to UTF-8
+  size_t utf8_length() const;
+
+  // Get the length (in UTF-16 code units) this string would have if converted to UTF-16
+  size_t utf16_length() const;
+
 private:
   char32_t* data_;
   size_t length_;
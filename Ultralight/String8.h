@@ -22,9 +22,15 @@ class String32;
 
 ///
 /// @brief  A UTF-8 string container.
+///
+/// Strings of kInlineCapacity bytes or less are stored inline (no heap allocation).
 //
 class UExport String8 {
 public:
+  // Max length (in bytes, not including the null terminator) of strings stored inline, without a
+  // heap allocation
+  static constexpr size_t kInlineCapacity = 15;
+
   // Make an empty String8
   String8();
 
@@ -37,11 +43,17 @@ public:
   // Make a deep copy of String8
   String8(const String8& other);
 
+  // Move a String8 into this one, other is left empty
+  String8(String8&& other) noexcept;
+
   ~String8();
 
   // Assign a String8 to this one, deep copy is made
   String8& operator=(const String8& other);
 
+  // Move a String8 into this one, other is left empty
+  String8& operator=(String8&& other) noexcept;
+
   // Append a String8 to this one.
   String8& operator+=(const String8& other);
 
@@ -49,10 +61,10 @@ public:
   inline friend String8 operator+(String8 lhs, const String8& rhs) { lhs += rhs; return lhs; }
 
   // Get raw UTF-8 data
-  char* data() { return data_; }
+  char* data() { return is_inline() ? inline_ : heap_.data; }
 
   // Get raw UTF-8 data (const)
-  const char* data() const { return data_; }
+  const char* data() const { return is_inline() ? inline_ : heap_.data; }
 
   // Get length in characters.
   size_t length() const { return length_; }
@@ -64,13 +76,13 @@ public:
   size_t sizeBytes() const { return length_ * sizeof(char); }
 
   // Check if string is empty.
-  bool empty() const { return !data_ || length_ == 0; }
+  bool empty() const { return length_ == 0; }
 
   // Get character at specific position
-  char& operator[](size_t pos) { return data_[pos]; }
+  char& operator[](size_t pos) { return data()[pos]; }
 
   // Get character at specific position (const)
-  const char& operator[](size_t pos) const { return data_[pos]; }
+  const char& operator[](size_t pos) const { return data()[pos]; }
 
   // Get a UTF-16 copy of this string
   String16 utf16() const;
@@ -78,8 +90,32 @@ public:
   // Get a UTF-32 copy of this string
   String32 utf32() const;
 
+  // Get the length (in UTF-16 code units) this string would have if converted to UTF-16
+  size_t utf16_length() const;
+
+  // Get the length (in code points) this string would have if converted to UTF-32
+  size_t utf32_length() const;
+
+  // Check if this string only contains ASCII characters
+  bool is_ascii() const;
+
+  // Check if this string is well-formed UTF-8. Conversions replace invalid sequences with
+  // U+FFFD (replacement character).
+  bool is_valid_utf8() const;
+
 private:
-  char* data_;
+  // Strings are stored inline when length_ <= kInlineCapacity, otherwise on the heap.
+  bool is_inline() const { return length_ <= kInlineCapacity; }
+
+  struct HeapData {
+    char* data;
+    size_t capacity;
+  };
+
+  union {
+    HeapData heap_;
+    char inline_[kInlineCapacity + 1];
+  };
   size_t length_;
 };
 
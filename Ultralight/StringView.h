@@ -0,0 +1,92 @@
+///
+/// @file StringView.h
+///
+/// @brief The header for the StringView class.
+///
+/// @author
+///
+/// This file is a part of Ultralight, a next-generation HTML renderer.
+///
+/// Website: <http://ultralig.ht>
+///
+/// Copyright (C) 2022 Ultralight, Inc. All rights reserved.
+///
+#pragma once
+#include <Ultralight/Defines.h>
+#include <Ultralight/String8.h>
+#include <Ultralight/String.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace ultralight {
+
+///
+/// @brief  A non-owning view of a UTF-8 string (pointer + length).
+///
+/// Pass this to APIs that accept a StringView (eg, View::LoadHTML) to avoid copying large
+/// payloads into a String first. The data is only read during the call, you remain responsible
+/// for keeping it alive until the call returns.
+///
+/// You can wrap any contiguous UTF-8 data, for example a std::string_view:
+/// <pre>
+///   view->LoadHTML(StringView(html.data(), html.size()));
+/// </pre>
+///
+/// @note  There is intentionally no implicit conversion from `const char*`, use
+///        StringView::FromCString to wrap a null-terminated string.
+///
+class UExport StringView {
+public:
+  // Make an empty StringView
+  StringView() : data_(nullptr), length_(0) {}
+
+  // Make a StringView of a raw UTF-8 string with certain length
+  StringView(const char* data, size_t len) : data_(data), length_(len) {}
+
+  // Make a StringView of an existing String (the String must outlive this view)
+  StringView(const String& str) : data_(str.utf8().data()), length_(str.utf8().length()) {}
+
+  // Make a StringView of an existing String8 (the String8 must outlive this view)
+  explicit StringView(const String8& str) : data_(str.data()), length_(str.length()) {}
+
+  // Make a StringView of a raw, null-terminated UTF-8 string
+  static StringView FromCString(const char* c_str) {
+    return c_str ? StringView(c_str, strlen(c_str)) : StringView();
+  }
+
+  // Get raw UTF-8 data (not necessarily null-terminated)
+  const char* data() const { return data_; }
+
+  // Get length in characters.
+  size_t length() const { return length_; }
+
+  // Get size in characters (synonym for length)
+  size_t size() const { return length_; }
+
+  // Get size in bytes
+  size_t sizeBytes() const { return length_ * sizeof(char); }
+
+  // Check if view is empty.
+  bool empty() const { return !data_ || length_ == 0; }
+
+  // Get character at specific position
+  const char& operator[](size_t pos) const { return data_[pos]; }
+
+  // Get a view of a sub-range of this string (clamped to the end of the string)
+  StringView substr(size_t pos, size_t len) const {
+    if (pos > length_)
+      pos = length_;
+    if (len > length_ - pos)
+      len = length_ - pos;
+    return StringView(data_ + pos, len);
+  }
+
+  // Make an owning String copy of this view
+  String ToString() const { return String(data_, length_); }
+
+private:
+  const char* data_;
+  size_t length_;
+};
+
+}  // namespace ultralight
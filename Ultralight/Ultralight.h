@@ -6,6 +6,7 @@
 #include <Ultralight/String16.h>
 #include <Ultralight/String32.h>
 #include <Ultralight/String.h>
+#include <Ultralight/StringView.h>
 #include <Ultralight/Bitmap.h>
 #include <Ultralight/Buffer.h>
 #include <Ultralight/View.h>
@@ -19,6 +20,7 @@
 #include <Ultralight/Geometry.h>
 #include <Ultralight/RenderTarget.h>
 #include <Ultralight/ScrollEvent.h>
+#include <Ultralight/Stats.h>
 #include <Ultralight/platform/Platform.h>
 #include <Ultralight/platform/Config.h>
 #include <Ultralight/platform/GPUDriver.h>
@@ -21,11 +21,27 @@
 #include <Ultralight/GamepadEvent.h>
 #include <Ultralight/RenderTarget.h>
 #include <Ultralight/Bitmap.h>
+#include <Ultralight/Buffer.h>
 #include <Ultralight/Listener.h>
+#include <Ultralight/Stats.h>
+#include <Ultralight/StringView.h>
 #include <Ultralight/platform/Surface.h>
 
 namespace ultralight {
 
+class View;
+
+///
+/// Function signature for the callback passed to View::CaptureNextFrame.
+///
+/// @param  user_data  The user data passed to View::CaptureNextFrame.
+///
+/// @param  caller     The View that was captured.
+///
+/// @param  bitmap     The captured pixels, or nullptr if the capture failed.
+///
+typedef void (*CaptureFrameCallback)(void* user_data, View* caller, RefPtr<Bitmap> bitmap);
+
 struct UExport ViewConfig {
   ///
   /// Whether to render using the GPU renderer (accelerated) or the CPU renderer (unaccelerated).
@@ -197,6 +213,43 @@ class UExport View : public RefCounted {
   ///
   virtual Surface* surface() = 0;
 
+  ///
+  /// Get runtime statistics for this View (GPU memory usage, etc.).
+  ///
+  /// @note  These values are updated at the end of each call to Renderer::Render.
+  ///
+  virtual ViewStats stats() = 0;
+
+  ///
+  /// Get the analysis of the GPU command list generated for the last frame rendered for this View
+  /// (overdraw heat-map, redundant binds, tiny draws, etc.).
+  ///
+  /// @note  This is only computed when Config::enable_frame_analysis is true, otherwise all
+  ///        values will be zero and the overdraw map will be null.
+  ///
+  virtual FrameAnalysis frame_analysis() = 0;
+
+  ///
+  /// Capture the pixels of the next frame rendered for this View into a Bitmap, without
+  /// stalling rendering.
+  ///
+  /// For GPU-accelerated Views this uses GPUDriver::ReadbackRenderBuffer, the callback will be
+  /// invoked during a later call to Renderer::Update or Renderer::Render once the GPU has finished
+  /// the copy. For CPU Views the pixels are copied from the Surface after the next paint.
+  ///
+  /// @param  callback   The callback to invoke with the captured Bitmap.
+  ///
+  /// @param  user_data  Optional user data that will be passed to the callback.
+  ///
+  /// @param  rect       An optional sub-rect to capture (units in pixels). Pass an empty rect
+  ///                    (the default) to capture the entire View.
+  ///
+  /// @note  A frame will be rendered for this View even if it does not otherwise need painting.
+  ///
+  virtual void CaptureNextFrame(CaptureFrameCallback callback, void* user_data,
+                                const IntRect& rect = IntRect::MakeEmpty())
+      = 0;
+
   ///
   /// Load a raw string of HTML, the View will navigate to it as a new page.
   ///
@@ -212,6 +265,41 @@ class UExport View : public RefCounted {
   virtual void LoadHTML(const String& html, const String& url = "", bool add_to_history = false)
       = 0;
 
+  ///
+  /// Load a raw string of HTML without copying it into a String first, the View will navigate to
+  /// it as a new page.
+  ///
+  /// @param  html  The raw HTML (UTF-8) to load, the data is only read during this call.
+  ///
+  /// @param  url   An optional URL for this load, @see LoadHTML(const String&, const String&, bool)
+  ///
+  /// @param  add_to_history  Whether or not this load should be added to the session's history
+  ///                         (eg, the back/forward list).
+  ///
+  virtual void LoadHTML(StringView html, const String& url = "", bool add_to_history = false) = 0;
+
+  ///
+  /// Load HTML from a Buffer, the View will navigate to it as a new page.
+  ///
+  /// The buffer is fed to the HTML parser directly (incrementally, in chunks) without first being
+  /// converted to a String. The View keeps a reference to the buffer until parsing is complete.
+  ///
+  /// @param  html     The raw HTML data to load.
+  ///
+  /// @param  url      The URL for this load (to make it appear as if we loaded this HTML from a
+  ///                  certain URL), pass an empty string for none.
+  ///
+  /// @param  charset  The text encoding of the data (eg, "utf-8", "utf-16le", "iso-8859-1").
+  ///
+  /// @param  add_to_history  Whether or not this load should be added to the session's history
+  ///                         (eg, the back/forward list).
+  ///
+  /// @note  The buffer's data should not be modified until the load has finished.
+  ///
+  virtual void LoadHTML(RefPtr<Buffer> html, const String& url, const String& charset,
+                        bool add_to_history = false)
+      = 0;
+
   ///
   /// Load a URL, the View will navigate to it as a new page.
   ///
@@ -271,6 +359,12 @@ class UExport View : public RefCounted {
   ///
   virtual String EvaluateScript(const String& script, String* exception = nullptr) = 0;
 
+  ///
+  /// Evaluate a string of JavaScript (UTF-8) without copying it into a String first, @see
+  /// EvaluateScript(const String&, String*)
+  ///
+  virtual String EvaluateScript(StringView script, String* exception = nullptr) = 0;
+
   ///
   /// Whether or not we can navigate backwards in history
   ///
@@ -98,6 +98,37 @@ struct UExport Config {
   ///
   double font_gamma = 1.8;
 
+  ///
+  /// Whether or not to cache the fallback fonts returned by the FontLoader, keyed by Unicode
+  /// block, weight, and italic. When enabled, the FontLoader is only queried again for a block
+  /// when the cached family's character map (cmap) does not cover the characters being rendered.
+  ///
+  /// Large blocks (eg, CJK Unified Ideographs or emoji and symbols) may be covered by several
+  /// families, a block can therefore hold more than one cached family-- each is checked for
+  /// coverage in the order it was cached.
+  ///
+  /// @note  This is disabled by default since it can still change which family is chosen when
+  ///        several installed fonts cover the same characters.
+  ///
+  bool cache_font_fallbacks = false;
+
+  ///
+  /// Whether or not to persist rasterized glyphs to disk so they can be reused on the next launch
+  /// instead of being rasterized again during the first frame.
+  ///
+  /// The glyph cache is written to a "glyphs" subdirectory of cache_path when you call
+  /// Renderer::SaveGlyphCache. Entries are keyed by the font's FontFile::content_hash (not its
+  /// path, so fonts updated in place are detected), font size, font_hinting, font_gamma, and the
+  /// library version (ULTRALIGHT_VERSION), so changing any of these invalidates the affected
+  /// glyphs. A saved cache is loaded lazily the first time each font face is used.
+  ///
+  /// For on-disk fonts the content hash only requires reading the font's OpenType table
+  /// directory, so persisted glyphs can be used at startup without reading the font in full.
+  ///
+  /// @note  This has no effect if cache_path is empty.
+  ///
+  bool enable_glyph_cache_persistence = false;
+
   ///
   /// Default user stylesheet. You should set this to your own custom CSS string to define default
   /// styles for various DOM elements, scrollbars, and platform input widgets.
@@ -110,6 +141,16 @@ struct UExport Config {
   ///
   bool force_repaint = false;
 
+  ///
+  /// Whether or not we should analyze the GPU command list generated for each View every frame
+  /// (overdraw, redundant binds, tiny draws, etc.). This is mainly used to diagnose GPU
+  /// performance issues and has a significant CPU cost. @see View::frame_analysis
+  ///
+  /// The analysis is performed on the CPU using the command list and geometry data, it does not
+  /// require a real GPU or GPUDriver support.
+  ///
+  bool enable_frame_analysis = false;
+
   ///
   /// When a CSS animation is active, the amount of time (in seconds) to wait before triggering
   /// another repaint. Default is 60 Hz.
@@ -178,6 +219,32 @@ struct UExport Config {
   /// 
   uint32_t num_renderer_threads = 0;
 
+  ///
+  /// Whether or not to rasterize newly-needed glyphs in parallel on the Renderer's worker threads
+  /// (@see num_renderer_threads). Glyphs are rasterized in batches and inserted into the glyph
+  /// atlas once per frame.
+  ///
+  bool parallel_glyph_rasterization = true;
+
+  ///
+  /// Whether or not to draw glyphs that are not yet rasterized using a scaled version of the
+  /// closest cached size (or nothing, if none is cached) for a frame while the final glyphs are
+  /// rasterized in the background. This keeps zooming and text-heavy pages responsive at the
+  /// cost of briefly lower-quality text.
+  ///
+  /// @note  This requires parallel_glyph_rasterization.
+  ///
+  bool progressive_glyph_rendering = false;
+
+  ///
+  /// The number of background threads to use for FileSystem loads that are not handled by
+  /// FileSystem::OpenFileAsync. Completed loads are delivered during the next Renderer::Update.
+  ///
+  /// @note  Your FileSystem::OpenFile implementation must be thread-safe to use this. If this value
+  ///        is 0 (the default), OpenFile is called synchronously on the main thread.
+  ///
+  uint32_t num_file_io_threads = 0;
+
   /// 
   /// The max amount of time (in seconds) to allow repeating timers to run during each call to
   /// Renderer::Update. The library will attempt to throttle timers and/or reschedule work if this
@@ -201,6 +268,74 @@ struct UExport Config {
   /// slight cost to performance.
   ///
   uint32_t bitmap_alignment = 16;
+
+  ///
+  /// The max amount of GPU memory (in bytes) to allocate through the GPUDriver for textures,
+  /// render buffers, and geometry. Only used when the GPU renderer is enabled.
+  ///
+  /// When this budget is exceeded, the library will evict cached image and glyph textures (least
+  /// recently used first). If it still can't get back under the budget (eg, the visible content
+  /// alone exceeds it), RendererListener::OnGPUMemoryBudgetExceeded is called.
+  ///
+  /// Set this to '0' (the default) for no limit.
+  ///
+  uint64_t gpu_memory_budget = 0;
+
+  ///
+  /// The max width and height (in pixels) of an accelerated View whose render target may be
+  /// packed into a shared atlas texture along with other small Views.
+  ///
+  /// Atlasing many small Views (eg, nameplates, tooltips) reduces the number of render buffers
+  /// and texture binds needed to composite them. Atlased Views are repacked when resized, so you
+  /// should re-query View::render_target after each call to Renderer::Render.
+  ///
+  /// Set this to '0' (the default) to give every View its own render buffer.
+  ///
+  uint32_t render_target_atlas_max_view_size = 0;
+
+  ///
+  /// The width and height (in pixels) of each shared render target atlas texture.
+  ///
+  /// @see render_target_atlas_max_view_size
+  ///
+  uint32_t render_target_atlas_size = 2048;
+
+  ///
+  /// The max amount of vertex/index data (in bytes) to retain across frames for unchanged
+  /// content. Only used when the GPU renderer is enabled.
+  ///
+  /// Tessellated geometry is cached per compositor layer and per display-list item (keyed by
+  /// content and transform) so that when a layer repaints, unchanged items reuse their existing
+  /// geometry IDs and only modified items are re-emitted to the GPUDriver.
+  ///
+  /// Set this to '0' to disable the cache.
+  ///
+  uint32_t geometry_cache_size = 8 * 1024 * 1024;
+
+  ///
+  /// The max amount of tessellated path data (in bytes) to keep in the path cache. Only used when
+  /// the GPU renderer is enabled.
+  ///
+  /// Paths (eg, SVG icons and rounded borders) are tessellated once per shape and scale bucket and
+  /// reused by every instance of that shape, transformed instances are drawn with the cached
+  /// vertices and a different GPUState::transform. Least-recently used paths are evicted first.
+  ///
+  /// Set this to '0' to disable the cache.
+  ///
+  uint32_t path_cache_size = 4 * 1024 * 1024;
+
+  ///
+  /// The max amount of text shaping results (in bytes) to keep in the shaping cache.
+  ///
+  /// Shaped runs (glyph IDs, advances, and offsets) are cached process-wide in an LRU keyed by
+  /// text, font, font size, font features, text direction (bidi level), script, and language, so
+  /// identical labels in different Views are only shaped once while text shown in a different
+  /// language or direction context (eg, localized forms) is shaped separately. The cache is shared
+  /// safely by all renderer threads.
+  ///
+  /// Set this to '0' to disable the cache.
+  ///
+  uint32_t text_shaping_cache_size = 2 * 1024 * 1024;
 };
 
 } // namespace ultralight
@@ -18,6 +18,45 @@
 
 namespace ultralight {
 
+///
+/// @brief  A pending asynchronous file load, @see FileSystem::OpenFileAsync
+///
+class UExport FileRequest : public RefCounted {
+ public:
+  ///
+  /// The file path that was requested.
+  ///
+  virtual String file_path() const = 0;
+
+  ///
+  /// Complete this request with the file contents (or nullptr if the file does not exist or could
+  /// not be opened).
+  ///
+  /// This is safe to call from any thread. The result will be delivered to the loader during the
+  /// next call to Renderer::Update. Only the first call has any effect.
+  ///
+  /// @param  buffer     The file contents, or nullptr on failure.
+  ///
+  /// @param  mime_type  The mime-type of the file (eg "text/html"). If empty, the library
+  ///                    determines it from the file extension.
+  ///
+  /// @param  charset    The charset / encoding of the file (eg "utf-8"). If empty, the library
+  ///                    detects it from the file contents (eg, byte-order mark or <meta> tag)
+  ///                    and falls back to "utf-8".
+  ///
+  /// @note  The same alignment requirements as FileSystem::OpenFile apply to the Buffer.
+  ///
+  virtual void Complete(RefPtr<Buffer> buffer, const String& mime_type = "",
+                        const String& charset = "")
+      = 0;
+
+ protected:
+  FileRequest();
+  virtual ~FileRequest();
+  FileRequest(const FileRequest&);
+  void operator=(const FileRequest&);
+};
+
 ///
 /// @brief  FileSystem interface.
 ///
@@ -81,8 +120,83 @@ class UExport FileSystem {
   ///        other files (but you may still see a performance benefit due to cache line alignment).
   ///        If you can't guarantee alignment or are unsure, you can use Buffer::CreateFromCopy to
   ///        copy the file data content to an aligned block (at the expense of data duplication).
+  ///
+  /// @note  The ICU data file is loaded lazily (only when locale or text-break data is first
+  ///        needed). ICU requires it as a single contiguous, 16-byte aligned block, so it is
+  ///        always loaded in full via this function (never via ReadFileRange)-- memory-mapping it
+  ///        here avoids a copy and lets the OS page in only the sections that are used.
+  ///        Initialized locale data (eg, break iterators and collators) is then cached per locale
+  ///        for the lifetime of the Renderer.
   /// 
   virtual RefPtr<Buffer> OpenFile(const String& file_path) = 0;
+
+  ///
+  /// Begin opening a file for reading without blocking the calling thread.
+  ///
+  /// This is called on the main thread when loading resources (eg, images, scripts,
+  /// stylesheets), before any other FileSystem call for that file. You should start the load (eg,
+  /// on your own I/O threads, or by queueing a network fetch or decryption job) and return
+  /// immediately, then call FileRequest::Complete when the data is ready. The result is delivered
+  /// at the next call to Renderer::Update.
+  ///
+  /// When you return true, FileExists, GetFileMimeType, GetFileCharset, and OpenFile are not
+  /// called for this request-- pass the mime-type and charset to FileRequest::Complete instead (or
+  /// leave them empty to have the library detect them), so no blocking call happens on the main
+  /// thread.
+  ///
+  /// @return  Return true if you will complete the request, or false to have the library fall
+  ///          back to the synchronous calls (the default implementation always returns false).
+  ///
+  /// @note  When falling back, FileExists, GetFileMimeType, GetFileCharset, and OpenFile are all
+  ///        called on the library's I/O threads if Config::num_file_io_threads is non-zero,
+  ///        otherwise they are called on the main thread.
+  ///
+  virtual bool OpenFileAsync(RefPtr<FileRequest> request);
+
+  ///
+  /// Get the last modification time of a file (in seconds since the Unix epoch).
+  ///
+  /// This is used to invalidate cached file data (@see CachingFileSystem in AppCore).
+  ///
+  /// @return  Return false if the modification time is unavailable (the default implementation
+  ///          always returns false).
+  ///
+  virtual bool GetFileModificationTime(const String& file_path, int64_t& result);
+
+  ///
+  /// Get the size of a file in bytes.
+  ///
+  /// Implement this along with ReadFileRange to let large files (eg, video, audio, and large
+  /// JSON datasets) be consumed incrementally instead of being loaded entirely via OpenFile.
+  ///
+  /// @return  Return false if the size is unavailable or ranged reads are not supported (the
+  ///          default implementation always returns false).
+  ///
+  virtual bool GetFileSize(const String& file_path, int64_t& result);
+
+  ///
+  /// Read a range of bytes from a file into a Buffer.
+  ///
+  /// This is only called if GetFileSize returned true for the file path. Media elements and fetch
+  /// responses read large files in chunks via this method so that only a bounded amount of the
+  /// file is held in memory at once.
+  ///
+  /// @param  file_path  The file to read from.
+  ///
+  /// @param  offset     The byte offset to begin reading at.
+  ///
+  /// @param  length     The max number of bytes to read, the returned Buffer may be smaller if
+  ///                    the end of the file is reached.
+  ///
+  /// @return  A Buffer containing the requested bytes, or nullptr if the read failed (the default
+  ///          implementation always returns nullptr).
+  ///
+  /// @note  The returned data should be aligned to a 16-byte boundary, the same as OpenFile
+  ///        (use Buffer::CreateFromCopy if you can't guarantee this). Files that must be loaded
+  ///        as a single contiguous block, such as the ICU data file, are never read through this
+  ///        function.
+  ///
+  virtual RefPtr<Buffer> ReadFileRange(const String& file_path, int64_t offset, size_t length);
 };
 
 } // namespace ultralight
@@ -21,18 +21,37 @@ namespace ultralight {
 ///
 /// Represents a font file, either on-disk path or in-memory file contents.
 ///
+/// Font files are shared process-wide so the font data and its parsed face are only loaded once
+/// no matter how many Views or Sessions use it:
+///   - Creating a font file from a path returns the existing instance with the same full path.
+///   - Creating a font file from a buffer returns the existing in-memory instance with the same
+///     full content (compared byte-for-byte).
+///
+/// On-disk fonts are never read in full to be matched (that would page in the entire mapped
+/// file), they are only matched by path.
+///
+/// The hashes (hash() and content_hash()) are only used to select a bucket, matches always
+/// compare the full path or content, so hash collisions never return the wrong font.
+///
 class UExport FontFile : public RefCounted {
  public:
   ///
   /// Create a font file from an on-disk file path.
   ///
+  /// The file will be memory-mapped (instead of read into memory) when it is first used.
+  ///
   /// @note  The file path should already exist.
   ///
+  /// @note  If a font file with the same path already exists, it is returned instead.
+  ///
   static RefPtr<FontFile> Create(const String& filepath);
 
   ///
   /// Create a font file from an in-memory buffer.
   ///
+  /// @note  If an in-memory font file with identical content already exists, it is returned
+  ///        instead and the passed buffer is released.
+  ///
   static RefPtr<FontFile> Create(RefPtr<Buffer> buffer);
 
   ///
@@ -55,6 +74,29 @@ class UExport FontFile : public RefCounted {
   ///
   virtual uint32_t hash() const = 0;
 
+  ///
+  /// Hash identifying the font data, used to find in-memory font files that may have the same
+  /// content and to key cached data derived from the font (eg, persisted glyphs).
+  ///
+  /// For in-memory font files this is a hash of the full content, computed on creation. For
+  /// on-disk font files it is computed when the file is first opened from the file size and the
+  /// OpenType table directory (the tag, checksum, and length of every table), which covers all of
+  /// the font's data but only requires reading the first few hundred bytes of the file.
+  ///
+  virtual uint64_t content_hash() const = 0;
+
+  ///
+  /// Whether or not the font data is memory-mapped from disk (rather than held in memory).
+  ///
+  virtual bool is_memory_mapped() const = 0;
+
+  ///
+  /// The number of bytes of memory used by this font file (font data held in memory plus its
+  /// parsed face and shaping tables, not including memory-mapped data). This memory is shared by
+  /// every View that uses the font.
+  ///
+  virtual size_t memory_usage() const = 0;
+
  protected:
   FontFile();
   virtual ~FontFile();
@@ -62,6 +104,55 @@ class UExport FontFile : public RefCounted {
   void operator=(const FontFile&);
 };
 
+///
+/// A list of fallback font families for consecutive runs of text, @see
+/// FontLoader::fallback_fonts_for_text
+///
+class UExport FallbackFontRuns : public RefCounted {
+ public:
+  ///
+  /// Create an empty list of runs.
+  ///
+  static RefPtr<FallbackFontRuns> Create();
+
+  ///
+  /// Add a run to the back of the list.
+  ///
+  /// @param  offset  The start of the run within the text (in UTF-16 code units).
+  ///
+  /// @param  length  The length of the run (in UTF-16 code units).
+  ///
+  /// @param  family  A font family name that can render every character in the run.
+  ///
+  virtual void push_back(uint32_t offset, uint32_t length, const String& family) = 0;
+
+  ///
+  /// Get the number of runs in the list.
+  ///
+  virtual size_t size() const = 0;
+
+  ///
+  /// Get the start of a certain run (in UTF-16 code units).
+  ///
+  virtual uint32_t offset(size_t index) const = 0;
+
+  ///
+  /// Get the length of a certain run (in UTF-16 code units).
+  ///
+  virtual uint32_t length(size_t index) const = 0;
+
+  ///
+  /// Get the font family name of a certain run.
+  ///
+  virtual String family(size_t index) const = 0;
+
+ protected:
+  FallbackFontRuns();
+  virtual ~FallbackFontRuns();
+  FallbackFontRuns(const FallbackFontRuns&);
+  void operator=(const FallbackFontRuns&);
+};
+
 ///
 /// @brief  Font Loader interface, used for all font lookup operations.
 ///
@@ -107,6 +198,33 @@ class UExport FontLoader {
   virtual String fallback_font_for_characters(const String& characters, int weight,
                                               bool italic) const = 0;
 
+  ///
+  /// Fallback font family names for an entire string of text, split into runs that can each be
+  /// rendered with a single font family. This lets the library resolve fallbacks for a whole
+  /// block of text with a single call instead of calling fallback_font_for_characters once per
+  /// character run.
+  ///
+  /// @param  text    The text to find fallback fonts for.
+  ///
+  /// @param  weight  Font weight.
+  ///
+  /// @param  italic  Whether or not italic is requested.
+  ///
+  /// @param  runs    An empty list to append runs to, offsets and lengths are in UTF-16 code
+  ///                 units (@see String::utf16). Runs should be in order and cover the entire
+  ///                 text.
+  ///
+  /// @return  Return false if batch queries are not supported, in which case the library will
+  ///          call fallback_font_for_characters instead (the default implementation always
+  ///          returns false).
+  ///
+  /// @note  Results from both fallback functions can be cached by the library per (Unicode block,
+  ///        weight, italic) and reused when they cover the requested characters, @see
+  ///        Config::cache_font_fallbacks.
+  ///
+  virtual bool fallback_fonts_for_text(const String& text, int weight, bool italic,
+                                       FallbackFontRuns& runs) const;
+
   ///
   /// Get the actual font file data (TTF/OTF) for a given font description.
   ///
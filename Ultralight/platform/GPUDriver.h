@@ -65,12 +65,70 @@ struct Vertex_2f_4ub_2f_2f_28f {
   float data6[4];
 };
 
+///
+/// Compact vertex layout for quad vertices, used in place of Vertex_2f_4ub_2f_2f_28f when
+/// GPUDriverCaps::supports_compact_vertices is true.
+///
+/// The texture coordinates are stored as 16-bit unsigned normalized integers (0 maps to 0.0,
+/// 65535 maps to 1.0) and the data slots are stored as IEEE 754 half-precision floats.
+///
+/// Normalized values in the data slots (colors, gradient stop offsets, and other 0-1
+/// parameters) are stored with an error below 1/2048, finer than 8-bit color resolution, and
+/// small integers (fill types and flags) are exact.
+///
+/// Pixel-space values in the data slots (gradient endpoints, rounded-rect sizes and radii, stroke
+/// widths, shadow offsets) are only stored at half precision if they survive an f32 -> f16 -> f32
+/// round trip unchanged (half precision steps by 0.5 between 512 and 1024, so fractional values
+/// at common sizes would otherwise shift SDF and anti-aliased edges). The library emits this
+/// format for a quad only when all of its pixel-space values round-trip exactly (eg, solid fills,
+/// images, and glyphs, which carry none), other quads are emitted as Vertex_2f_4ub_2f_2f_28f. The
+/// pos and obj members are always full precision.
+///
+struct Vertex_2f_4ub_2us_2f_28h {
+  float pos[2];
+  unsigned char color[4];
+  uint16_t tex[2];
+  float obj[2];
+  uint16_t data0[4];
+  uint16_t data1[4];
+  uint16_t data2[4];
+  uint16_t data3[4];
+  uint16_t data4[4];
+  uint16_t data5[4];
+  uint16_t data6[4];
+};
+
+///
+/// Per-instance layout for instanced quads, used when GPUDriverCaps::supports_instanced_quads is
+/// true. Each instance describes an entire quad (the four corners are generated in the vertex
+/// shader from a static unit quad), so per-quad data is stored once rather than on four vertices.
+///
+/// The rects are stored as {left, top, right, bottom}, texture coordinates are 16-bit unsigned
+/// normalized integers and the data slots are IEEE 754 half-precision floats (the same precision
+/// rules as Vertex_2f_4ub_2us_2f_28h apply).
+///
+struct QuadInstance_4f_4ub_4us_4f_28h {
+  float pos[4];
+  unsigned char color[4];
+  uint16_t tex[4];
+  float obj[4];
+  uint16_t data0[4];
+  uint16_t data1[4];
+  uint16_t data2[4];
+  uint16_t data3[4];
+  uint16_t data4[4];
+  uint16_t data5[4];
+  uint16_t data6[4];
+};
+
 ///
 /// Vertex buffer formats (identifiers start with underscore due to C++ naming rules)
 ///
 enum class UExport VertexBufferFormat : uint8_t {
   _2f_4ub_2f,
   _2f_4ub_2f_2f_28f,
+  _2f_4ub_2us_2f_28h,           // @see Vertex_2f_4ub_2us_2f_28h
+  _Instance_4f_4ub_4us_4f_28h,  // @see QuadInstance_4f_4ub_4us_4f_28h
 };
 
 ///
@@ -87,12 +145,30 @@ struct UExport VertexBuffer {
 ///
 typedef uint32_t IndexType;
 
+///
+/// Compact vertex index type, used for geometry with fewer than 65536 vertices when
+/// GPUDriverCaps::supports_16bit_indices is true.
+///
+typedef uint16_t IndexType16;
+
+///
+/// Vertex index formats, used by IndexBuffer::format
+///
+enum class UExport IndexFormat : uint8_t {
+  UInt32, // Each index is an IndexType
+  UInt16, // Each index is an IndexType16
+};
+
 ///
 /// Vertex index buffer, @see GPUDriver::CreateGeometry
 ///
+/// @note  Geometry using VertexBufferFormat::_Instance_4f_4ub_4us_4f_28h has no index buffer
+///        (size will be 0).
+///
 struct UExport IndexBuffer {
   uint32_t size;
   uint8_t* data;
+  IndexFormat format;
 };
 
 ///
@@ -103,7 +179,8 @@ struct UExport IndexBuffer {
 ///
 enum class UExport ShaderType : uint8_t {
   Fill,     // Shader program for quad geometry
-  FillPath, // Shader program for path geometry
+  FillPath, // Shader program for path geometry (may be shared by several draws, each with
+            // its own GPUState::transform)
 };
 
 ///
@@ -144,12 +221,19 @@ struct UExport GPUState {
   uint32_t texture_3_id;
 
   /// The following four members are passed to the pixel shader via uniforms.
+  ///
+  /// If GPUDriverCaps::supports_scissor_clipping is set, the clip matrices are only used for
+  /// rounded or transformed clips-- axis-aligned clips that are snapped to the pixel grid are
+  /// lowered to scissor_rect instead (clip_size will be 0 if there are no other clips).
   float uniform_scalar[8];
   vec4 uniform_vector[8];
   uint8_t clip_size;
   Matrix4x4 clip[8];
 
   /// Whether or not scissor testing should be used for the current draw command.
+  ///
+  /// If GPUDriverCaps::supports_scissor_clipping is set, this is also used to apply axis-aligned
+  /// clips to draw commands.
   bool enable_scissor;
 
   /// The scissor rect to use for scissor testing (units in pixels)
@@ -175,6 +259,11 @@ struct UExport Command {
   uint32_t geometry_id;     // The geometry ID to bind
   uint32_t indices_count;   // The number of indices
   uint32_t indices_offset;  // The index to start from
+
+  /// The following members are only used when drawing geometry with an instanced vertex format
+  /// (indices_count and indices_offset are unused in this case).
+  uint32_t instance_count;  // The number of quad instances to draw
+  uint32_t instance_offset; // The instance to start from
 };
 
 ///
@@ -187,6 +276,76 @@ struct UExport CommandList {
 
 #pragma pack(pop)
 
+///
+/// Optional features supported by a GPUDriver, @see GPUDriver::capabilities
+///
+/// The library will only emit the corresponding formats and commands if your driver reports
+/// support for them here.
+///
+struct UExport GPUDriverCaps {
+  ///
+  /// Whether the driver supports VertexBufferFormat::_2f_4ub_2us_2f_28h for quad geometry.
+  ///
+  /// Quads whose pixel-space data values don't round-trip exactly through half precision still use
+  /// VertexBufferFormat::_2f_4ub_2f_2f_28f, so drivers must continue to support both formats.
+  ///
+  bool supports_compact_vertices = false;
+
+  ///
+  /// Whether the driver supports IndexFormat::UInt16 index buffers.
+  ///
+  bool supports_16bit_indices = false;
+
+  ///
+  /// Whether the driver supports VertexBufferFormat::_Instance_4f_4ub_4us_4f_28h and instanced
+  /// draw commands (Command::instance_count).
+  ///
+  bool supports_instanced_quads = false;
+
+  ///
+  /// The maximum number of frames the GPU may be executing at once (eg, the CPU may build frame
+  /// N+1 while the GPU is still executing frame N).
+  ///
+  /// When this is greater than 1, the library will call GPUDriver::SignalFrameFence at the end of
+  /// each frame and will never update or destroy a resource referenced by an in-flight frame
+  /// (@see GPUDriver::LastCompletedFrame):
+  ///   - Dynamic resources that are updated every frame (eg, the glyph atlas, textures receiving
+  ///     partial updates, and dynamic geometry) are renamed: the library keeps one copy per frame
+  ///     in flight (each with its own ID) and rotates between them, so updates always target a
+  ///     copy the GPU is no longer using.
+  ///   - Destroy calls are queued and dispatched once the last frame using the resource completes.
+  ///
+  /// The library only waits (by polling LastCompletedFrame) if the GPU falls more than
+  /// max_frames_in_flight frames behind.
+  ///
+  /// The default (1) means all work for a frame is assumed complete once EndSynchronize returns.
+  ///
+  uint32_t max_frames_in_flight = 1;
+
+  ///
+  /// Whether the driver supports asynchronous readback of render buffers via
+  /// GPUDriver::ReadbackRenderBuffer.
+  ///
+  bool supports_async_readback = false;
+
+  ///
+  /// Whether the driver applies GPUState::enable_scissor / scissor_rect to all draw commands (not
+  /// just scissored clears). When set, axis-aligned, pixel-snapped clips are lowered to the
+  /// scissor rect instead of being evaluated per-pixel via clip matrices.
+  ///
+  bool supports_scissor_clipping = false;
+};
+
+///
+/// Function signature for the completion callback passed to GPUDriver::ReadbackRenderBuffer.
+///
+/// @param  context  The opaque context passed to GPUDriver::ReadbackRenderBuffer.
+///
+/// @param  bitmap   The pixels that were read back (BitmapFormat::BGRA8_UNORM_SRGB), or nullptr
+///                  if the readback failed.
+///
+typedef void (*ReadbackCompleteCallback)(void* context, RefPtr<Bitmap> bitmap);
+
 ///
 /// @brief  GPUDriver interface, dispatches GPU calls to the native driver.
 ///
@@ -200,6 +359,16 @@ class UExport GPUDriver {
  public:
   virtual ~GPUDriver();
 
+  ///
+  /// Get the optional features supported by this driver.
+  ///
+  /// This is called once when the Renderer is created.
+  ///
+  /// @note  The default implementation reports no optional features (quad geometry will use
+  ///        Vertex_2f_4ub_2f_2f_28f with 32-bit indices).
+  ///
+  virtual GPUDriverCaps capabilities() const;
+
   ///
   /// Called before any commands are dispatched during a frame.
   ///
@@ -210,6 +379,32 @@ class UExport GPUDriver {
   ///
   virtual void EndSynchronize() = 0;
 
+  ///
+  /// Called after EndSynchronize to mark the end of all commands dispatched for a certain frame.
+  /// You should insert a fence (eg, glFenceSync, ID3D12Fence::Signal) into your GPU command
+  /// stream here so you can later report when the GPU has finished executing this frame.
+  ///
+  /// @param  frame_index  A monotonically increasing index for the frame (the first frame is 1).
+  ///
+  /// @note  This is only called if GPUDriverCaps::max_frames_in_flight is greater than 1. The
+  ///        default implementation does nothing.
+  ///
+  virtual void SignalFrameFence(uint64_t frame_index);
+
+  ///
+  /// Get the index of the most recent frame that the GPU has finished executing (eg, the highest
+  /// frame_index passed to SignalFrameFence whose fence has been reached), or 0 if none.
+  ///
+  /// Any texture, render buffer, or geometry used by a frame with a greater index is considered
+  /// in-flight-- updates are redirected to another copy of the resource (one copy is kept per
+  /// frame in flight) and destroy calls are deferred until that frame completes, so the CPU does
+  /// not stall, @see GPUDriverCaps::max_frames_in_flight.
+  ///
+  /// @note  This is only called if GPUDriverCaps::max_frames_in_flight is greater than 1. This
+  ///        should not block. The default implementation returns 0.
+  ///
+  virtual uint64_t LastCompletedFrame();
+
   ///
   /// Get the next available texture ID.
   ///
@@ -228,6 +423,28 @@ class UExport GPUDriver {
   ///
   virtual void UpdateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) = 0;
 
+  ///
+  /// Update one or more regions of an existing non-RTT texture with new bitmap data.
+  ///
+  /// This is used for textures that change only partially between frames (eg, glyph and image
+  /// atlases). Only the pixels within the dirty rects need to be uploaded, you can use
+  /// glTexSubImage2D, ID3D11DeviceContext::UpdateSubresource with a destination box, or similar
+  /// for each rect.
+  ///
+  /// @param  texture_id       The texture to update.
+  ///
+  /// @param  bitmap           The full bitmap for the texture, same dimensions as the texture.
+  ///
+  /// @param  dirty_rects      The regions of the bitmap that have changed (units in pixels). These
+  ///                          rects are clipped to the bounds of the bitmap and do not overlap.
+  ///
+  /// @param  num_dirty_rects  The number of rects in dirty_rects.
+  ///
+  /// @note  The default implementation re-uploads the entire bitmap via UpdateTexture().
+  ///
+  virtual void UpdateTextureRegions(uint32_t texture_id, RefPtr<Bitmap> bitmap,
+                                    const IntRect* dirty_rects, uint32_t num_dirty_rects);
+
   ///
   /// Destroy a texture.
   ///
@@ -256,6 +473,9 @@ class UExport GPUDriver {
   ///
   /// Create geometry with certain ID and vertex/index data.
   ///
+  /// @note  Geometry may be retained and drawn in many frames without being updated, you should
+  ///        keep it resident until DestroyGeometry is called.
+  ///
   virtual void CreateGeometry(uint32_t geometry_id, const VertexBuffer& vertices,
                               const IndexBuffer& indices)
       = 0;
@@ -276,6 +496,29 @@ class UExport GPUDriver {
   /// Update command list (you should copy the commands to your own structure).
   ///
   virtual void UpdateCommandList(const CommandList& list) = 0;
+
+  ///
+  /// Request an asynchronous copy of a render buffer's pixels into a Bitmap.
+  ///
+  /// The copy should be performed after all commands in the current command list have executed
+  /// without stalling the pipeline (eg, copy to a staging buffer or PBO and map it once the GPU
+  /// has caught up a few frames later).
+  ///
+  /// @param  render_buffer_id  The render buffer to read from.
+  ///
+  /// @param  rect              The region to read (units in pixels, clipped to the render buffer).
+  ///
+  /// @param  callback          The callback to invoke once the pixels are available. You must
+  ///                           invoke this exactly once, on the thread the Renderer was created
+  ///                           on (eg, during a later BeginSynchronize).
+  ///
+  /// @param  context           An opaque value to pass back to the callback.
+  ///
+  /// @note  This is only called if GPUDriverCaps::supports_async_readback is true. The default
+  ///        implementation invokes the callback immediately with a nullptr bitmap.
+  ///
+  virtual void ReadbackRenderBuffer(uint32_t render_buffer_id, const IntRect& rect,
+                                    ReadbackCompleteCallback callback, void* context);
 };
 
 } // namespace ultralight